@@ -24,6 +24,37 @@ inline void m5dial_lvgl_init(bool call_m5_begin = true)
     lv_port_indev_init();
 }
 
+/* Advance the LVGL tick by the real time elapsed and run due timers.
+ * Returns the time until the next LVGL timer is due (for event-driven loops). */
+inline uint32_t m5dial_lvgl_service()
+{
+    static uint32_t last_ms = M5.millis();
+    uint32_t now_ms = M5.millis();
+    lv_tick_inc(now_ms - last_ms);
+    last_ms = now_ms;
+    return lv_timer_handler();
+}
+
+/* Resume input polling and read all input devices on the next service call */
+inline void m5dial_lvgl_wake_input()
+{
+    for (lv_indev_t *indev = lv_indev_get_next(NULL); indev != NULL; indev = lv_indev_get_next(indev))
+    {
+        lv_timer_t *timer = lv_indev_get_read_timer(indev);
+        lv_timer_resume(timer);
+        lv_timer_ready(timer);
+    }
+}
+
+/* Stop periodic input polling until the next m5dial_lvgl_wake_input() */
+inline void m5dial_lvgl_idle_input()
+{
+    for (lv_indev_t *indev = lv_indev_get_next(NULL); indev != NULL; indev = lv_indev_get_next(indev))
+    {
+        lv_timer_pause(lv_indev_get_read_timer(indev));
+    }
+}
+
 inline void m5dial_lvgl_next()
 {
     M5.update();
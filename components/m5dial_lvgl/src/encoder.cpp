@@ -6,13 +6,14 @@
 #include <freertos/task.h>
 #include <driver/pulse_cnt.h>
 #include <driver/gpio.h>
+#include <esp_attr.h>
 #include "encoder.hpp"
 
 #define PCNT_LOW_LIMIT -32768
 #define PCNT_HIGH_LIMIT 32767
 
 
-Encoder::Encoder()
+Encoder::Encoder() : _count(PCNT_LOW_LIMIT, PCNT_HIGH_LIMIT)
 {
     _pcnt_unit = NULL;
     _pcnt_chan_a = NULL;
@@ -34,9 +35,15 @@ void Encoder::setup(gpio_num_t pin_a, gpio_num_t pin_b)
     unit_config.low_limit = PCNT_LOW_LIMIT;
     unit_config.high_limit = PCNT_HIGH_LIMIT;
     unit_config.intr_priority = 0;
-    unit_config.flags.accum_count = 0;
     ESP_ERROR_CHECK(pcnt_new_unit(&unit_config, &_pcnt_unit));
 
+    /* Fold limit crossings into a 32-bit accumulator (EncoderCount) */
+    ESP_ERROR_CHECK(pcnt_unit_add_watch_point(_pcnt_unit, PCNT_HIGH_LIMIT));
+    ESP_ERROR_CHECK(pcnt_unit_add_watch_point(_pcnt_unit, PCNT_LOW_LIMIT));
+    pcnt_event_callbacks_t callbacks = {};
+    callbacks.on_reach = onReach;
+    ESP_ERROR_CHECK(pcnt_unit_register_event_callbacks(_pcnt_unit, &callbacks, this));
+
     pcnt_glitch_filter_config_t filter_config = {};
     filter_config.max_glitch_ns = 1000;
     ESP_ERROR_CHECK(pcnt_unit_set_glitch_filter(_pcnt_unit, &filter_config));
@@ -61,19 +68,36 @@ void Encoder::setup(gpio_num_t pin_a, gpio_num_t pin_b)
     ESP_ERROR_CHECK(pcnt_unit_start(_pcnt_unit));
 }
 
-int Encoder::getCount(bool clear)
+bool IRAM_ATTR Encoder::onReach(pcnt_unit_handle_t unit, const pcnt_watch_event_data_t *edata, void *user_ctx)
+{
+    Encoder *encoder = (Encoder *)user_ctx;
+    portENTER_CRITICAL_ISR(&encoder->_lock);
+    encoder->_count.onLimit(edata->watch_point_value);
+    portEXIT_CRITICAL_ISR(&encoder->_lock);
+    return false;
+}
+
+int32_t Encoder::getPosition()
 {
+    /* Count and accumulator are read together so a limit event cannot land in between */
     int count = 0;
-    ESP_ERROR_CHECK(pcnt_unit_get_count(_pcnt_unit, &count));
-    if (clear)
-    {
-        ESP_ERROR_CHECK(pcnt_unit_clear_count(_pcnt_unit));
-    }
-    return count;
+    portENTER_CRITICAL(&_lock);
+    pcnt_unit_get_count(_pcnt_unit, &count);
+    int32_t position = _count.position(count);
+    portEXIT_CRITICAL(&_lock);
+    return position;
+}
+
+int32_t Encoder::getDelta(int32_t &last_position)
+{
+    return EncoderCount::delta(getPosition(), last_position);
 }
 
 void Encoder::reset()
 {
-    ESP_ERROR_CHECK(pcnt_unit_clear_count(_pcnt_unit));
+    portENTER_CRITICAL(&_lock);
+    pcnt_unit_clear_count(_pcnt_unit);
+    _count.reset();
+    portEXIT_CRITICAL(&_lock);
 }
 #endif
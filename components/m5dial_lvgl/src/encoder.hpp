@@ -1,9 +1,13 @@
 // SPDX-License-Identifier: MIT
 // SPDX-FileCopyrightText: Copyright 2024 mzyy94
 
+#include <stdint.h>
+
 #if defined(ESP_PLATFORM)
 #include <driver/pulse_cnt.h>
 #include <driver/gpio.h>
+#include <freertos/FreeRTOS.h>
+#include "encoder_count.hpp"
 
 class Encoder
 {
@@ -15,11 +19,20 @@ private:
     pcnt_channel_handle_t _pcnt_chan_a;
     pcnt_channel_handle_t _pcnt_chan_b;
 
+    EncoderCount _count;  /* Guarded by _lock (shared with the watch-point ISR) */
+    portMUX_TYPE _lock = portMUX_INITIALIZER_UNLOCKED;
+
+    static bool onReach(pcnt_unit_handle_t unit, const pcnt_watch_event_data_t *edata, void *user_ctx);
+
 public:
     Encoder();
     ~Encoder();
     void setup(gpio_num_t pin_a = GPIO_NUM_40, gpio_num_t pin_b = GPIO_NUM_41);
-    int getCount(bool clear = false);
+    /* Accumulated position since setup(); never cleared by reads, so no edge is lost */
+    int32_t getPosition();
+    /* Steps since last_position, which is then advanced to the current position */
+    int32_t getDelta(int32_t &last_position);
+    /* Zero the position; consumers tracking a last position must re-read it */
     void reset();
 };
 #else
@@ -27,7 +40,8 @@ class Encoder
 {
 public:
     inline void setup(){};
-    inline int getCount(bool clear = false) { return 0; };
+    inline int32_t getPosition() { return 0; };
+    inline int32_t getDelta(int32_t &last_position) { return 0; };
     inline void reset(){};
 };
 #endif
@@ -0,0 +1,83 @@
+// SPDX-License-Identifier: MIT
+// SPDX-FileCopyrightText: Copyright 2024 mzyy94
+
+#pragma once
+
+#include <stdint.h>
+
+/* 32-bit encoder position on top of a 16-bit PCNT unit.
+ * The hardware counter returns to 0 each time it reaches one of its limits;
+ * the watch-point event for that limit adds it to a software accumulator, so
+ * accumulator + hardware count is the position and no edge is ever lost.
+ * A read can land between the counter reset and its (still pending) event:
+ * the count then jumps by about a full limit, so the crossing is credited at
+ * once and the event, when it arrives, only settles the credit.
+ * Assumes fewer than limit / 2 edges between reads.
+ * No driver calls here: Encoder feeds it, host tests drive it directly. */
+class EncoderCount
+{
+public:
+    EncoderCount(int low_limit, int high_limit) : _low(low_limit), _high(high_limit) {}
+
+    /* Start again from position (the hardware count is cleared at the same time) */
+    void reset(int32_t position = 0)
+    {
+        _accum = (uint32_t)position;
+        _credit = 0;
+        _since_read = 0;
+        _last_count = 0;
+    }
+
+    /* The hardware counter reached limit and went back to 0 (watch-point event) */
+    void onLimit(int limit)
+    {
+        _accum += (uint32_t)limit;
+        if (_credit == limit)
+        {
+            _credit = 0;
+        }
+        else
+        {
+            _since_read += limit;
+        }
+    }
+
+    /* Position for a hardware count read (32-bit, wraps like int32_t) */
+    int32_t position(int hw_count)
+    {
+        int jump = hw_count - _last_count;
+        int crossed = 0;
+        if (jump < -_high / 2)
+        {
+            crossed = _high;
+        }
+        else if (jump > -_low / 2)
+        {
+            crossed = _low;
+        }
+        if (crossed != 0 && _since_read == 0)
+        {
+            _credit += crossed;  // Limit reached, event not handled yet
+        }
+        _since_read = 0;
+        _last_count = hw_count;
+        return (int32_t)(_accum + (uint32_t)_credit + (uint32_t)hw_count);
+    }
+
+    /* Steps since last_position, which is then advanced to position.
+     * Unsigned subtraction keeps the delta right across 32-bit wrap. */
+    static int32_t delta(int32_t position, int32_t &last_position)
+    {
+        int32_t delta = (int32_t)((uint32_t)position - (uint32_t)last_position);
+        last_position = position;
+        return delta;
+    }
+
+private:
+    int _low;
+    int _high;
+    uint32_t _accum = 0;     // Sum of handled limit events (+ reset position)
+    int _credit = 0;         // Crossings seen in the count whose event is still pending
+    int _since_read = 0;     // Limits handled since the last position() call
+    int _last_count = 0;     // Hardware count at the last position() call
+};
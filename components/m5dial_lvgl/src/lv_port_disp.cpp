@@ -4,12 +4,22 @@
 #include "lv_port_disp.h"
 #include <stdbool.h>
 #include <M5Unified.hpp>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <math.h>
+#include <string.h>
 
 #define MY_DISP_HOR_RES 240
 #define MY_DISP_VER_RES 240
 
+/* The M5Dial glass is a circle inscribed in the 240x240 panel */
+#define MY_DISP_ROUND 1
+
 static void disp_init(void);
 static void disp_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map);
+static void disp_flush_wait(lv_display_t *disp);
+static void disp_refr_event_cb(lv_event_t *e);
+static void disp_invalidate_event_cb(lv_event_t *e);
 
 void lv_port_disp_init(void)
 {
@@ -17,14 +27,94 @@ void lv_port_disp_init(void)
 
     lv_display_t *disp = lv_display_create(MY_DISP_HOR_RES, MY_DISP_VER_RES);
     lv_display_set_flush_cb(disp, disp_flush);
+    lv_display_set_flush_wait_cb(disp, disp_flush_wait);
 
-    static lv_color_t buf_2_1[MY_DISP_HOR_RES * 10];
-    static lv_color_t buf_2_2[MY_DISP_HOR_RES * 10];
+    /* Word aligned: the buffers are byte-swapped 32 bits at a time and read by SPI DMA */
+    static lv_color_t buf_2_1[MY_DISP_HOR_RES * 10] __attribute__((aligned(4)));
+    static lv_color_t buf_2_2[MY_DISP_HOR_RES * 10] __attribute__((aligned(4)));
     lv_display_set_buffers(disp, buf_2_1, buf_2_2, sizeof(buf_2_1), LV_DISPLAY_RENDER_MODE_PARTIAL);
+
+    lv_display_add_event_cb(disp, disp_refr_event_cb, LV_EVENT_REFR_START, NULL);
+    lv_display_add_event_cb(disp, disp_refr_event_cb, LV_EVENT_REFR_READY, NULL);
+#if MY_DISP_ROUND
+    lv_display_add_event_cb(disp, disp_invalidate_event_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+#endif
 }
 
+/* First and last visible column of each row (chord of the circle) */
+static int16_t row_x1[MY_DISP_VER_RES];
+static int16_t row_x2[MY_DISP_VER_RES];
+
 static void disp_init(void)
 {
+    /* Include every pixel the circle touches so anti-aliased edges survive */
+    const float r = MY_DISP_HOR_RES / 2.0f;
+    for (int32_t y = 0; y < MY_DISP_VER_RES; y++)
+    {
+        float dy = (y < r) ? (r - y) : (y + 1 - r);
+        if (dy > r)
+        {
+            dy = r;
+        }
+        float half = sqrtf(r * r - (dy - 1) * (dy - 1));
+        int32_t x1 = (int32_t)floorf(r - half);
+        int32_t x2 = (int32_t)ceilf(r + half) - 1;
+        row_x1[y] = (int16_t)(x1 < 0 ? 0 : x1);
+        row_x2[y] = (int16_t)(x2 > MY_DISP_HOR_RES - 1 ? MY_DISP_HOR_RES - 1 : x2);
+    }
+}
+
+/* Shrink an area to the bounding box of its on-glass part.
+ * Returns false if no pixel of the area is visible. */
+static bool clip_to_glass(lv_area_t *area)
+{
+    int32_t y1 = area->y1;
+    int32_t y2 = area->y2;
+    while (y1 <= y2 && (row_x2[y1] < area->x1 || row_x1[y1] > area->x2))
+    {
+        y1++;
+    }
+    while (y2 >= y1 && (row_x2[y2] < area->x1 || row_x1[y2] > area->x2))
+    {
+        y2--;
+    }
+    if (y1 > y2)
+    {
+        return false;
+    }
+
+    /* The widest chord within the remaining rows bounds the columns */
+    int32_t x1 = MY_DISP_HOR_RES;
+    int32_t x2 = -1;
+    for (int32_t y = y1; y <= y2; y++)
+    {
+        if (row_x1[y] < x1)
+        {
+            x1 = row_x1[y];
+        }
+        if (row_x2[y] > x2)
+        {
+            x2 = row_x2[y];
+        }
+    }
+
+    area->x1 = LV_MAX(area->x1, x1);
+    area->x2 = LV_MIN(area->x2, x2);
+    area->y1 = y1;
+    area->y2 = y2;
+    return true;
+}
+
+static void disp_invalidate_event_cb(lv_event_t *e)
+{
+    lv_area_t *area = (lv_area_t *)lv_event_get_param(e);
+    if (!clip_to_glass(area))
+    {
+        /* LVGL cannot drop an invalidation from here; shrink it to one
+         * off-glass pixel, which disp_flush() then skips. */
+        area->x2 = area->x1;
+        area->y2 = area->y1;
+    }
 }
 
 volatile bool disp_flush_enabled = true;
@@ -39,16 +129,131 @@ void disp_disable_update(void)
     disp_flush_enabled = false;
 }
 
+static uint32_t s_last_frame_us = 0;
+static bool s_frame_flushed = false;
+
+uint32_t disp_last_frame_us(void)
+{
+    return s_last_frame_us;
+}
+
+/* LVGL renders little-endian RGB565, the GC9A01 wants big-endian.
+ * Swap in place so the DMA engine can read straight from the draw buffer
+ * instead of M5GFX converting through its own bounce buffer. */
+static void swap_rgb565(uint8_t *px_map, uint32_t px_count)
+{
+    uint32_t *words = (uint32_t *)px_map;
+    uint32_t pairs = px_count / 2;
+    for (uint32_t i = 0; i < pairs; i++)
+    {
+        uint32_t w = words[i];
+        words[i] = ((w & 0xFF00FF00u) >> 8) | ((w & 0x00FF00FFu) << 8);
+    }
+    if (px_count & 1)
+    {
+        uint16_t *last = (uint16_t *)px_map + (px_count - 1);
+        *last = (uint16_t)((*last >> 8) | (*last << 8));
+    }
+}
+
+/* Drop the off-glass margins of a rendered band by packing the visible
+ * columns of each row to the front of the buffer. Rows only ever move
+ * towards the start, so this is safe in place. */
+static void pack_to_area(uint8_t *px_map, const lv_area_t *from, const lv_area_t *to)
+{
+    int32_t from_w = from->x2 - from->x1 + 1;
+    int32_t to_w = to->x2 - to->x1 + 1;
+    if (from_w == to_w && from->y1 == to->y1)
+    {
+        return;
+    }
+
+    uint16_t *px = (uint16_t *)px_map;
+    for (int32_t y = to->y1; y <= to->y2; y++)
+    {
+        const uint16_t *src = px + (y - from->y1) * from_w + (to->x1 - from->x1);
+        uint16_t *dst = px + (y - to->y1) * to_w;
+        memmove(dst, src, to_w * sizeof(uint16_t));
+    }
+}
+
+static void disp_flush_finish_frame(lv_display_t *disp_drv)
+{
+    M5.Display.waitDMA();
+    if (M5.Display.getStartCount() > 0)
+    {
+        M5.Display.endWrite();
+    }
+    lv_display_flush_ready(disp_drv);
+}
+
+/* Start the transfer and return so LVGL can render the next band into the
+ * other buffer. The buffer is handed back in disp_flush_wait(), which LVGL
+ * only calls when it needs this buffer again. */
 static void disp_flush(lv_display_t *disp_drv, const lv_area_t *area, uint8_t *px_map)
 {
-    if (disp_flush_enabled)
+    lv_area_t visible = *area;
+    bool on_glass = true;
+#if MY_DISP_ROUND
+    on_glass = clip_to_glass(&visible);
+#endif
+
+    if (!disp_flush_enabled || !on_glass)
+    {
+        if (lv_display_flush_is_last(disp_drv))
+        {
+            disp_flush_finish_frame(disp_drv);
+        }
+        else
+        {
+            lv_display_flush_ready(disp_drv);
+        }
+        return;
+    }
+
+    pack_to_area(px_map, area, &visible);
+
+    int32_t width = visible.x2 - visible.x1 + 1;
+    int32_t height = visible.y2 - visible.y1 + 1;
+    swap_rgb565(px_map, (uint32_t)(width * height));
+
+    if (M5.Display.getStartCount() == 0)
     {
-        int32_t width = area->x2 - area->x1 + 1;
-        int32_t height = area->y2 - area->y1 + 1;
-        M5.Display.setAddrWindow(area->x1, area->y1, width, height);
-        M5.Display.pushPixels((uint16_t *)px_map, width * height, true);
+        M5.Display.startWrite();
     }
+    M5.Display.pushImageDMA(visible.x1, visible.y1, width, height, (const lgfx::swap565_t *)px_map);
+
+    s_frame_flushed = true;
 
-    M5.Display.waitDisplay();
+    /* Release the bus at the end of each frame so nothing else sees a
+     * half-open transaction between refreshes. */
+    if (lv_display_flush_is_last(disp_drv))
+    {
+        disp_flush_finish_frame(disp_drv);
+    }
+}
+
+static void disp_flush_wait(lv_display_t *disp_drv)
+{
+    M5.Display.waitDMA();
     lv_display_flush_ready(disp_drv);
 }
+
+static void disp_refr_event_cb(lv_event_t *e)
+{
+    static int64_t refr_start_us = 0;
+
+    if (lv_event_get_code(e) == LV_EVENT_REFR_START)
+    {
+        refr_start_us = esp_timer_get_time();
+        s_frame_flushed = false;
+        return;
+    }
+
+    if (!s_frame_flushed)
+    {
+        return;
+    }
+    s_last_frame_us = (uint32_t)(esp_timer_get_time() - refr_start_us);
+    ESP_LOGD("lv_port_disp", "frame refresh %lu us", (unsigned long)s_last_frame_us);
+}
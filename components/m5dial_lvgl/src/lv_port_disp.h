@@ -25,6 +25,11 @@ void disp_enable_update(void);
  */
 void disp_disable_update(void);
 
+/* Duration of the last refresh that flushed pixels, in microseconds
+ * (render + SPI transfer). Useful for comparing flush strategies.
+ */
+uint32_t disp_last_frame_us(void);
+
 #ifdef __cplusplus
 } // extern "C"
 #endif
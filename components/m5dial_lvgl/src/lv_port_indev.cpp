@@ -24,6 +24,7 @@ lv_indev_t *indev_touchpad;
 lv_indev_t *indev_encoder;
 
 Encoder encoder;
+static int32_t encoder_last_position = 0;
 
 void lv_port_indev_init(void)
 {
@@ -79,11 +80,12 @@ static void touchpad_get_xy(int32_t *x, int32_t *y)
 static void encoder_init(void)
 {
     encoder.setup();
+    encoder_last_position = encoder.getPosition();
 }
 
 static void encoder_read(lv_indev_t *indev_drv, lv_indev_data_t *data)
 {
-    int diff = encoder.getCount(true);
+    int diff = encoder.getDelta(encoder_last_position);
     data->enc_diff = diff;
     data->state = M5.BtnA.isPressed() ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
     if (diff != 0)
@@ -0,0 +1,178 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include "chip_set.hpp"
+
+/// Blind levels for every progression mode and starting small blind,
+/// generated at compile time and stored in flash.
+/// Round N's blinds are a table lookup instead of repeated float math,
+/// so screens can preview any upcoming level for free.
+namespace blinds {
+
+/// Progression modes, in BlindProgressionScreen order (also the GameRecord blind_mode encoding)
+enum class Mode : uint8_t { Standard = 0, Turbo = 1, Relaxed = 2 };
+
+constexpr int kModeCount = 3;
+constexpr float kMultipliers[kModeCount] = {1.5f, 2.0f, 1.25f};
+
+// Starting small blinds selectable on SmallBlindScreen
+constexpr int kStartMin = 25;
+constexpr int kStartMax = 200;
+constexpr int kStartStep = 25;
+constexpr int kStartCount = (kStartMax - kStartMin) / kStartStep + 1;
+
+constexpr int kMaxBlind = 9999;  // Failsafe ceiling
+
+/// Highest level actually used: the ceiling rounded down to a payable blind
+constexpr int kCapBlind = kMaxBlind / chips::rounding_unit(kMaxBlind) * chips::rounding_unit(kMaxBlind);
+
+/// Levels stored per schedule; later rounds stay at the last (capped) level
+constexpr int kLevels = 32;
+
+/// Next level's small blind. This is the one definition of the progression rules:
+/// multiply, then round to the nearest multiple of the largest chip worth at most
+/// half the blind (so blinds are posted with few, large chips). An exact tie goes
+/// to the level needing fewer chips for SB + BB. Every level goes up by at least
+/// one rounding unit, and levels stop at kCapBlind.
+constexpr int next_small_blind(int small_blind, float multiplier) {
+    float target = small_blind * multiplier;
+    int unit = chips::rounding_unit(static_cast<int>(target));
+    int lower = static_cast<int>(target / unit) * unit;
+    int upper = lower + unit;
+
+    int rounded = upper;
+    float below = target - lower;
+    float above = upper - target;
+    if (below < above) {
+        rounded = lower;
+    } else if (below == above) {
+        int lower_chips = chips::chips_to_pay(lower) + chips::chips_to_pay(lower * 2);
+        int upper_chips = chips::chips_to_pay(upper) + chips::chips_to_pay(upper * 2);
+        rounded = lower_chips < upper_chips ? lower : upper;
+    }
+
+    if (rounded <= small_blind) {
+        rounded = (small_blind / unit + 1) * unit;
+    }
+    if (rounded > kCapBlind) {
+        rounded = kCapBlind;
+    }
+    return rounded;
+}
+
+using Schedule = std::array<uint16_t, kLevels>;
+
+/// Level rule signature: next small blind from the current one and a multiplier
+using NextRule = int (*)(int small_blind, float multiplier);
+
+/// Small blind for rounds 1..kLevels starting from start_small_blind
+constexpr Schedule make_schedule(int start_small_blind, float multiplier, NextRule next = next_small_blind) {
+    Schedule levels{};
+    int small_blind = start_small_blind;
+    for (int i = 0; i < kLevels; i++) {
+        levels[i] = static_cast<uint16_t>(small_blind);
+        small_blind = next(small_blind, multiplier);
+    }
+    return levels;
+}
+
+using ScheduleTable = std::array<std::array<Schedule, kStartCount>, kModeCount>;
+
+/// Schedules for every mode and start (the rule is a parameter so host tests
+/// can run the same generator on reference rules)
+constexpr ScheduleTable make_schedule_table(NextRule next = next_small_blind) {
+    ScheduleTable table{};
+    for (int mode = 0; mode < kModeCount; mode++) {
+        for (int start = 0; start < kStartCount; start++) {
+            table[mode][start] = make_schedule(kStartMin + start * kStartStep, kMultipliers[mode], next);
+        }
+    }
+    return table;
+}
+
+/// Every schedule, indexed [mode][start index][round - 1]
+inline constexpr ScheduleTable kSchedules = make_schedule_table();
+
+constexpr bool all_schedules_reach_cap() {
+    for (const auto& mode : kSchedules) {
+        for (const auto& schedule : mode) {
+            if (schedule[kLevels - 1] != kCapBlind) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+static_assert(all_schedules_reach_cap(), "kLevels too small: a schedule has not reached kCapBlind");
+
+/// Mode for a stored multiplier (STANDARD if it matches none)
+constexpr Mode mode_for_multiplier(float multiplier) {
+    for (int mode = 0; mode < kModeCount; mode++) {
+        if (kMultipliers[mode] == multiplier) {
+            return static_cast<Mode>(mode);
+        }
+    }
+    return Mode::Standard;
+}
+
+/// Table row for a starting small blind, or -1 if it is not a selectable value
+constexpr int start_index(int start_small_blind) {
+    if (start_small_blind < kStartMin || start_small_blind > kStartMax ||
+        (start_small_blind - kStartMin) % kStartStep != 0) {
+        return -1;
+    }
+    return (start_small_blind - kStartMin) / kStartStep;
+}
+
+/// Small blind in a given round
+/// @param mode Progression mode
+/// @param start_small_blind Round 1 small blind
+/// @param round Round number (1-based; values below 1 are treated as 1)
+constexpr int small_blind_at(Mode mode, int start_small_blind, int round) {
+    if (round < 1) {
+        round = 1;
+    }
+    int start = start_index(start_small_blind);
+    if (start < 0) {
+        // Not in the table (never offered by the UI): walk the rules instead
+        int small_blind = start_small_blind;
+        for (int r = 1; r < round && small_blind < kCapBlind; r++) {
+            small_blind = next_small_blind(small_blind, kMultipliers[static_cast<int>(mode)]);
+        }
+        return small_blind;
+    }
+    if (round > kLevels) {
+        return kCapBlind;
+    }
+    return kSchedules[static_cast<int>(mode)][start][round - 1];
+}
+
+/// First round whose small blind is at least target (kLevels + 1 if never)
+constexpr int first_round_reaching(Mode mode, int start_small_blind, int target) {
+    for (int round = 1; round <= kLevels; round++) {
+        if (small_blind_at(mode, start_small_blind, round) >= target) {
+            return round;
+        }
+    }
+    return kLevels + 1;
+}
+
+/// Chips that can be coloured up when a round starts: bit i set means
+/// chips::kChipSet[i] is no longer needed to post the blinds from this round on.
+constexpr uint32_t colour_up_mask(Mode mode, int start_small_blind, int round) {
+    if (round <= 1) {
+        return 0;
+    }
+    int before = chips::smallest_needed_chip(small_blind_at(mode, start_small_blind, round - 1));
+    int after = chips::smallest_needed_chip(small_blind_at(mode, start_small_blind, round));
+    uint32_t mask = 0;
+    for (int i = 0; i < chips::kDenominationCount; i++) {
+        if (chips::kChipSet[i].value >= before && chips::kChipSet[i].value < after) {
+            mask |= 1u << i;
+        }
+    }
+    return mask;
+}
+
+} // namespace blinds
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <cstdint>
+
+/// The physical chip set on the table: denominations, colours and how many
+/// of each make up a starting stack. Blind rounding and the chip breakdown
+/// overlays are derived from this one table.
+namespace chips {
+
+struct Denomination {
+    uint16_t value;       // Chip value
+    uint8_t per_stack;    // Chips of this value in one starting stack
+    const char* name;     // Colour name shown to players
+    uint32_t color;       // Display colour (0xRRGGBB)
+};
+
+/// Denominations in ascending value order
+constexpr Denomination kChipSet[] = {
+    {25, 16, "Blue", 0x4488FF},
+    {50, 20, "White", 0xFFFFFF},
+    {100, 6, "Red", 0xFF4444},
+};
+
+constexpr int kDenominationCount = sizeof(kChipSet) / sizeof(kChipSet[0]);
+
+constexpr bool ascending_values() {
+    for (int i = 1; i < kDenominationCount; i++) {
+        if (kChipSet[i].value <= kChipSet[i - 1].value) {
+            return false;
+        }
+    }
+    return true;
+}
+static_assert(ascending_values(), "kChipSet must be sorted by ascending value");
+
+/// Smallest chip value (every blind is a multiple of it)
+constexpr int kSmallestChip = kChipSet[0].value;
+
+/// Total value of one starting stack
+constexpr int starting_stack() {
+    int total = 0;
+    for (const auto& chip : kChipSet) {
+        total += chip.value * chip.per_stack;
+    }
+    return total;
+}
+
+/// Chips needed to pay an amount, largest denominations first.
+/// Exact minimum for canonical chip sets (all standard poker sets are).
+/// @return Chip count, or -1 if the amount cannot be paid exactly
+constexpr int chips_to_pay(int amount) {
+    int count = 0;
+    for (int i = kDenominationCount - 1; i >= 0; i--) {
+        count += amount / kChipSet[i].value;
+        amount %= kChipSet[i].value;
+    }
+    return amount == 0 ? count : -1;
+}
+
+/// Largest denomination worth at most half of amount, so a blind of that size
+/// takes at least two chips (the smallest chip if none qualifies).
+constexpr int rounding_unit(int amount) {
+    int unit = kSmallestChip;
+    for (const auto& chip : kChipSet) {
+        if (chip.value * 2 <= amount) {
+            unit = chip.value;
+        }
+    }
+    return unit;
+}
+
+/// Smallest chip still needed to post a small blind (and its 2x big blind):
+/// the largest rounding-unit-sized denomination that divides it exactly.
+constexpr int smallest_needed_chip(int small_blind) {
+    int needed = kSmallestChip;
+    for (const auto& chip : kChipSet) {
+        if (chip.value * 2 <= small_blind && small_blind % chip.value == 0) {
+            needed = chip.value;
+        }
+    }
+    return needed;
+}
+
+} // namespace chips
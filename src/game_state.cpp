@@ -1,9 +1,41 @@
 #include "game_state.hpp"
-#include <M5Unified.hpp>
+#include <cstdio>
+#include <esp_attr.h>
 #include <esp_log.h>
+#include <esp_rom_crc.h>
+#include <esp_system.h>
+#include <esp_timer.h>
+#include "storage/event_journal.hpp"
 
 namespace {
 constexpr const char* kLogTag = "game_state";
+
+/// Copy of the game in progress that survives a reset (not a power cycle)
+struct Snapshot {
+    uint32_t magic;
+    uint32_t version;
+    int32_t small_blind;
+    int32_t starting_small_blind;
+    int32_t big_blind;
+    int32_t round_minutes;
+    float blind_multiplier;
+    int32_t current_round;
+    int32_t seconds_remaining;
+    int32_t max_round_reached;
+    int64_t active_us;
+    int64_t paused_us;
+    int64_t round_active_us;
+    uint32_t crc;  // CRC32 of every field above
+};
+
+constexpr uint32_t kSnapshotMagic = 0x50434853;  // "PCHS"
+constexpr uint32_t kSnapshotVersion = 2;
+
+RTC_NOINIT_ATTR Snapshot s_snapshot;
+
+uint32_t snapshot_crc(const Snapshot& snap) {
+    return esp_rom_crc32_le(0, reinterpret_cast<const uint8_t*>(&snap), offsetof(Snapshot, crc));
+}
 }
 
 GameState& GameState::instance() {
@@ -13,15 +45,19 @@ GameState& GameState::instance() {
 
 void GameState::reset() {
     small_blind_ = 25;
+    starting_small_blind_ = 25;
     big_blind_ = 50;
     round_minutes_ = 15;
     blind_multiplier_ = 1.5f;
     current_round_ = 1;
     seconds_remaining_ = 0;
-    total_game_seconds_ = 0;
-    total_paused_seconds_ = 0;
-    pause_start_ms_ = 0;
+    clock_ = Clock::Stopped;
+    segment_start_us_ = 0;
+    active_us_ = 0;
+    paused_us_ = 0;
+    round_active_us_ = 0;
     max_round_reached_ = 1;
+    s_snapshot.magic = 0;  // Nothing to resume any more
     ESP_LOGI(kLogTag, "State reset to defaults");
 }
 
@@ -31,7 +67,9 @@ void GameState::set_small_blind(int value) {
         return;
     }
     small_blind_ = value;
+    starting_small_blind_ = value;
     big_blind_ = value * 2;  // Maintain invariant
+    save_snapshot();
     ESP_LOGI(kLogTag, "Blinds set: SB=%d, BB=%d", small_blind_, big_blind_);
 }
 
@@ -41,6 +79,7 @@ void GameState::set_round_minutes(int minutes) {
         return;
     }
     round_minutes_ = minutes;
+    save_snapshot();
     ESP_LOGI(kLogTag, "Round duration set: %d minutes", round_minutes_);
 }
 
@@ -50,6 +89,7 @@ void GameState::set_blind_multiplier(float multiplier) {
         return;
     }
     blind_multiplier_ = multiplier;
+    save_snapshot();
     ESP_LOGI(kLogTag, "Blind multiplier set: %.2fx", blind_multiplier_);
 }
 
@@ -59,6 +99,7 @@ void GameState::set_current_round(int round) {
         return;
     }
     current_round_ = round;
+    save_snapshot();
 }
 
 void GameState::set_seconds_remaining(int seconds) {
@@ -67,12 +108,14 @@ void GameState::set_seconds_remaining(int seconds) {
         return;
     }
     seconds_remaining_ = seconds;
+    save_snapshot();
 }
 
 int GameState::decrement_seconds() {
     if (seconds_remaining_ > 0) {
         seconds_remaining_--;
     }
+    save_snapshot();
     return seconds_remaining_;
 }
 
@@ -83,41 +126,166 @@ void GameState::update_blinds(int new_small_blind) {
     }
     small_blind_ = new_small_blind;
     big_blind_ = new_small_blind * 2;  // Maintain invariant
+    save_snapshot();
     ESP_LOGI(kLogTag, "Blinds updated: SB=%d, BB=%d", small_blind_, big_blind_);
 }
 
 void GameState::start_game_timer() {
-    total_game_seconds_ = 0;
-    total_paused_seconds_ = 0;
-    pause_start_ms_ = 0;
+    clock_ = Clock::Running;
+    segment_start_us_ = esp_timer_get_time();
+    active_us_ = 0;
+    paused_us_ = 0;
+    round_active_us_ = 0;
     max_round_reached_ = 1;
+    save_snapshot();
+    storage::EventJournal::instance().record(storage::JournalEvent::NewGame, round_minutes_);
     ESP_LOGI(kLogTag, "Game timer started");
 }
 
-void GameState::tick_game_timer() {
-    total_game_seconds_++;
+void GameState::start_round_timer() {
+    int64_t now = esp_timer_get_time();
+    if (clock_ == Clock::Running) {
+        // Fold the running segment into the game total so the round starts from zero
+        active_us_ += now - segment_start_us_;
+        segment_start_us_ = now;
+    }
+    round_active_us_ = 0;
+    save_snapshot();
+    storage::EventJournal::instance().record(storage::JournalEvent::RoundStart, current_round_);
 }
 
 void GameState::pause_game_timer() {
-    if (pause_start_ms_ == 0) {
-        pause_start_ms_ = M5.millis();
-        ESP_LOGI(kLogTag, "Game timer paused at %lus game time", (unsigned long)total_game_seconds_);
+    if (clock_ != Clock::Running) {
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+    int64_t segment = now - segment_start_us_;
+    active_us_ += segment;
+    round_active_us_ += segment;
+    segment_start_us_ = now;
+    clock_ = Clock::Paused;
+    save_snapshot();
+    storage::EventJournal::instance().record(storage::JournalEvent::Pause, current_round_);
+    ESP_LOGI(kLogTag, "Game timer paused at %lld ms game time", (long long)(active_us_ / 1000));
+}
+
+void GameState::resume_game_timer(bool journal) {
+    if (clock_ != Clock::Paused) {
+        return;
+    }
+    int64_t now = esp_timer_get_time();
+    int64_t pause = now - segment_start_us_;
+    paused_us_ += pause;
+    segment_start_us_ = now;
+    clock_ = Clock::Running;
+    save_snapshot();
+    if (journal) {
+        storage::EventJournal::instance().record(storage::JournalEvent::Resume, current_round_);
+    }
+    ESP_LOGI(kLogTag, "Game timer resumed (paused for %lld ms, total paused: %lld ms)",
+             (long long)(pause / 1000), (long long)(paused_us_ / 1000));
+}
+
+int64_t GameState::active_us() const {
+    if (clock_ == Clock::Running) {
+        return active_us_ + (esp_timer_get_time() - segment_start_us_);
+    }
+    return active_us_;
+}
+
+int64_t GameState::paused_us() const {
+    if (clock_ == Clock::Paused) {
+        return paused_us_ + (esp_timer_get_time() - segment_start_us_);
     }
+    return paused_us_;
 }
 
-void GameState::resume_game_timer() {
-    if (pause_start_ms_ != 0) {
-        uint32_t pause_duration_ms = M5.millis() - pause_start_ms_;
-        uint32_t pause_duration_secs = pause_duration_ms / 1000;
-        total_paused_seconds_ += pause_duration_secs;
-        pause_start_ms_ = 0;
-        ESP_LOGI(kLogTag, "Game timer resumed (paused for %lus, total paused: %lus)",
-                 (unsigned long)pause_duration_secs, (unsigned long)total_paused_seconds_);
+int64_t GameState::round_active_us() const {
+    if (clock_ == Clock::Running) {
+        return round_active_us_ + (esp_timer_get_time() - segment_start_us_);
+    }
+    return round_active_us_;
+}
+
+void GameState::format_duration(int64_t us, char* buf, size_t len) {
+    int64_t total_secs = us > 0 ? us / kUsPerSecond : 0;
+    long hours = static_cast<long>(total_secs / 3600);
+    int mins = static_cast<int>((total_secs % 3600) / 60);
+    int secs = static_cast<int>(total_secs % 60);
+
+    if (hours > 0) {
+        snprintf(buf, len, "%ld:%02d:%02d", hours, mins, secs);
+    } else {
+        snprintf(buf, len, "%d:%02d", mins, secs);
     }
 }
 
 void GameState::record_max_round(int round) {
     if (round > max_round_reached_) {
         max_round_reached_ = round;
+        save_snapshot();
+    }
+}
+
+void GameState::checkpoint() {
+    save_snapshot();
+}
+
+void GameState::save_snapshot() {
+    if (clock_ == Clock::Stopped) {
+        return;  // No game in progress yet
     }
+    Snapshot& snap = s_snapshot;
+    snap.magic = kSnapshotMagic;
+    snap.version = kSnapshotVersion;
+    snap.small_blind = small_blind_;
+    snap.starting_small_blind = starting_small_blind_;
+    snap.big_blind = big_blind_;
+    snap.round_minutes = round_minutes_;
+    snap.blind_multiplier = blind_multiplier_;
+    snap.current_round = current_round_;
+    snap.seconds_remaining = seconds_remaining_;
+    snap.max_round_reached = max_round_reached_;
+    snap.active_us = active_us();
+    snap.paused_us = paused_us();
+    snap.round_active_us = round_active_us();
+    snap.crc = snapshot_crc(snap);
+}
+
+bool GameState::restore_snapshot() {
+    esp_reset_reason_t reason = esp_reset_reason();
+    if (reason == ESP_RST_POWERON || reason == ESP_RST_UNKNOWN) {
+        return false;  // RTC memory holds garbage after a power cycle
+    }
+
+    const Snapshot& snap = s_snapshot;
+    if (snap.magic != kSnapshotMagic || snap.version != kSnapshotVersion || snap.crc != snapshot_crc(snap)) {
+        return false;
+    }
+    if (snap.small_blind <= 0 || snap.starting_small_blind <= 0 || snap.round_minutes <= 0 || snap.current_round <= 0 ||
+        snap.seconds_remaining < 0 || snap.active_us < 0 || snap.paused_us < 0) {
+        ESP_LOGW(kLogTag, "Snapshot out of range, ignoring");
+        return false;
+    }
+
+    small_blind_ = snap.small_blind;
+    starting_small_blind_ = snap.starting_small_blind;
+    big_blind_ = snap.big_blind;
+    round_minutes_ = snap.round_minutes;
+    blind_multiplier_ = snap.blind_multiplier;
+    current_round_ = snap.current_round;
+    seconds_remaining_ = snap.seconds_remaining;
+    max_round_reached_ = snap.max_round_reached;
+    active_us_ = snap.active_us;
+    paused_us_ = snap.paused_us;
+    round_active_us_ = snap.round_active_us;
+
+    // Come back paused; the time the device was down is not counted
+    clock_ = Clock::Paused;
+    segment_start_us_ = esp_timer_get_time();
+    save_snapshot();
+
+    ESP_LOGI(kLogTag, "Resumed after reset (reason %d): round %d, SB=%d, %ds left",
+             reason, current_round_, small_blind_, seconds_remaining_);
+    return true;
 }
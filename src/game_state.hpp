@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 /// Global game state shared across screens.
@@ -15,6 +16,7 @@ public:
 
     // Configuration getters
     int small_blind() const { return small_blind_; }
+    int starting_small_blind() const { return starting_small_blind_; }
     int big_blind() const { return big_blind_; }
     int round_minutes() const { return round_minutes_; }
     float blind_multiplier() const { return blind_multiplier_; }
@@ -23,15 +25,30 @@ public:
     int current_round() const { return current_round_; }
     int seconds_remaining() const { return seconds_remaining_; }
 
-    // Game timer getters
-    uint32_t total_game_seconds() const { return total_game_seconds_; }
-    uint32_t total_paused_seconds() const { return total_paused_seconds_; }
-    uint32_t total_overall_seconds() const { return total_game_seconds_ + total_paused_seconds_; }
+    // Game timer getters (exact microseconds, including the segment in progress)
+    int64_t active_us() const;
+    int64_t paused_us() const;
+    int64_t overall_us() const { return active_us() + paused_us(); }
+    /// Active (unpaused) time spent in the current round
+    int64_t round_active_us() const;
+    bool is_timer_paused() const { return clock_ == Clock::Paused; }
+
+    // Whole-second views (truncated once from the exact totals)
+    uint32_t total_game_seconds() const { return static_cast<uint32_t>(active_us() / kUsPerSecond); }
+    uint32_t total_paused_seconds() const { return static_cast<uint32_t>(paused_us() / kUsPerSecond); }
+    uint32_t total_overall_seconds() const { return static_cast<uint32_t>(overall_us() / kUsPerSecond); }
     int max_round_reached() const { return max_round_reached_; }
-    uint32_t pause_start_ms() const { return pause_start_ms_; }
+
+    static constexpr int64_t kUsPerSecond = 1000000;
+
+    /// Format a duration as "M:SS", or "H:MM:SS" from one hour up
+    /// @param us Duration in microseconds (negative values format as 0:00)
+    /// @param buf Output buffer (16 bytes is plenty)
+    /// @param len Size of buf
+    static void format_duration(int64_t us, char* buf, size_t len);
 
     // Configuration setters with validation
-    /// Set small blind value (automatically updates big blind to 2x)
+    /// Set starting small blind value (automatically updates big blind to 2x)
     /// @param value Small blind amount (must be positive)
     void set_small_blind(int value);
 
@@ -64,26 +81,41 @@ public:
     /// Start/reset game timer (called when round 1 begins)
     void start_game_timer();
 
-    /// Increment game time by 1 second (called every tick during active play)
-    void tick_game_timer();
+    /// Start timing a new round (called when the round advances)
+    void start_round_timer();
 
-    /// Record pause start time (called when pausing)
+    /// Close the active segment and start timing the pause (called when pausing)
     void pause_game_timer();
 
-    /// Accumulate paused time and resume (called when unpausing)
-    void resume_game_timer();
+    /// Close the paused segment and resume active time (called when unpausing)
+    /// @param journal False if the caller records its own event instead of Resume (Skip)
+    void resume_game_timer(bool journal = true);
 
     /// Update max round if current round is higher
     /// @param round Current round number
     void record_max_round(int round);
 
+    // Reset survival
+    /// Refresh the RTC snapshot with the current running totals
+    /// (state changes already do this; call while time passes without them)
+    void checkpoint();
+
+    /// Restore a game in progress from the RTC snapshot after a reset
+    /// (brownout, watchdog, panic). The clock comes back paused.
+    /// @return true if a valid snapshot was restored
+    bool restore_snapshot();
+
 private:
     GameState() = default;
     GameState(const GameState&) = delete;
     GameState& operator=(const GameState&) = delete;
 
+    /// Mirror the game in progress into RTC_NOINIT memory (CRC protected, no flash writes)
+    void save_snapshot();
+
     // Configuration (set by setup screens)
     int small_blind_ = 25;
+    int starting_small_blind_ = 25;  // Round 1 small blind (selects the blind schedule)
     int big_blind_ = 50;
     int round_minutes_ = 15;
     float blind_multiplier_ = 1.5f;  // STANDARD progression (1.25=RELAXED, 1.5=STANDARD, 2.0=TURBO)
@@ -92,9 +124,12 @@ private:
     int current_round_ = 1;
     int seconds_remaining_ = 0;
 
-    // Game session timing
-    uint32_t total_game_seconds_ = 0;    // In-game time (playing)
-    uint32_t total_paused_seconds_ = 0;  // Time spent paused
-    uint32_t pause_start_ms_ = 0;        // Timestamp when pause started (0 if not paused)
-    int max_round_reached_ = 1;          // Highest round number achieved
+    // Game session timing (esp_timer microseconds; 64-bit, never wraps in practice)
+    enum class Clock : uint8_t { Stopped, Running, Paused };
+    Clock clock_ = Clock::Stopped;
+    int64_t segment_start_us_ = 0;  // When the current running/paused segment began
+    int64_t active_us_ = 0;         // Closed running segments
+    int64_t paused_us_ = 0;         // Closed paused segments
+    int64_t round_active_us_ = 0;   // Closed running segments of the current round
+    int max_round_reached_ = 1;     // Highest round number achieved
 };
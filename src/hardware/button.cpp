@@ -1,5 +1,5 @@
 #include "button.hpp"
-#include <esp_timer.h>
+#include <esp_attr.h>
 #include <esp_log.h>
 
 namespace hardware {
@@ -20,67 +20,136 @@ Button::Button(gpio_num_t pin, uint32_t debounce_ms, uint32_t long_press_ms)
     cfg.pull_down_en = GPIO_PULLDOWN_DISABLE;
     cfg.intr_type = GPIO_INTR_DISABLE;
     gpio_config(&cfg);
+}
+
+void Button::begin() {
+    esp_timer_create_args_t debounce_args = {};
+    debounce_args.callback = debounce_timer_cb;
+    debounce_args.arg = this;
+    debounce_args.name = "btn_debounce";
+    ESP_ERROR_CHECK(esp_timer_create(&debounce_args, &debounce_timer_));
+
+    esp_timer_create_args_t long_press_args = {};
+    long_press_args.callback = long_press_timer_cb;
+    long_press_args.arg = this;
+    long_press_args.name = "btn_long";
+    ESP_ERROR_CHECK(esp_timer_create(&long_press_args, &long_press_timer_));
+
+    // ISR service may already be installed by another driver
+    esp_err_t err = gpio_install_isr_service(0);
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+        ESP_LOGE(kLogTag, "GPIO ISR service install failed: %s", esp_err_to_name(err));
+        return;
+    }
+
+    pressed_.store(gpio_get_level(pin_) == 0);
+    gpio_set_intr_type(pin_, GPIO_INTR_ANYEDGE);
+    ESP_ERROR_CHECK(gpio_isr_handler_add(pin_, gpio_isr, this));
+    gpio_intr_enable(pin_);
 
     ESP_LOGI(kLogTag, "Button initialized on GPIO %d (debounce=%lums, long_press=%lums)",
              pin_, debounce_ms_, long_press_ms_);
 }
 
 void Button::update() {
-    bool raw_pressed = gpio_get_level(pin_) == 0;  // Active low
-    uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000ULL);
-
-    // Debounce: only update state if stable for debounce_ms_
-    if (raw_pressed != debounced_state_) {
-        if (now_ms - last_change_ms_ >= debounce_ms_) {
-            debounced_state_ = raw_pressed;
-            last_change_ms_ = now_ms;
+    Event ev;
+    while (events_.pop(ev)) {
+        switch (ev.type) {
+            case Event::Type::Press:
+                ESP_LOGI(kLogTag, "Button pressed (GPIO %d)", pin_);
+                break;
+
+            case Event::Type::Release:
+                ESP_LOGI(kLogTag, "Button released (GPIO %d)", pin_);
+                break;
+
+            case Event::Type::ShortPress:
+                ESP_LOGI(kLogTag, "Short press (GPIO %d)", pin_);
+                if (short_press_cb_) {
+                    short_press_cb_();
+                }
+                break;
+
+            case Event::Type::LongPress:
+                ESP_LOGI(kLogTag, "Long press detected (GPIO %d)", pin_);
+                if (long_press_cb_) {
+                    long_press_cb_();
+                }
+                break;
         }
-    } else {
-        last_change_ms_ = now_ms;
     }
+}
 
-    bool pressed = debounced_state_;
+uint32_t Button::held_duration_ms() const {
+    if (!pressed_.load()) {
+        return 0;
+    }
+    return (uint32_t)((esp_timer_get_time() - press_start_us_.load()) / 1000);
+}
 
-    // Detect press
-    if (pressed && !prev_state_) {
-        ESP_LOGI(kLogTag, "Button pressed (GPIO %d)", pin_);
-        press_start_ms_ = now_ms;
-        long_press_triggered_ = false;
+void Button::push_event(Event::Type type, int64_t timestamp_us) {
+    if (!events_.push(Event{type, timestamp_us})) {
+        dropped_.fetch_add(1);
+        return;
     }
-    // Detect long press
-    else if (pressed && prev_state_) {
-        uint32_t held_ms = now_ms - press_start_ms_;
-        if (held_ms >= long_press_ms_ && !long_press_triggered_) {
-            ESP_LOGI(kLogTag, "Long press detected (GPIO %d, %lums)", pin_, held_ms);
-            long_press_triggered_ = true;
-            if (long_press_cb_) {
-                long_press_cb_();
-            }
-        }
+    if (queued_cb_) {
+        queued_cb_();
     }
-    // Detect release
-    else if (!pressed && prev_state_) {
-        uint32_t held_ms = now_ms - press_start_ms_;
-        ESP_LOGI(kLogTag, "Button released (GPIO %d, %lums)", pin_, held_ms);
-
-        // Only trigger short press if long press wasn't triggered
-        if (held_ms < long_press_ms_ && !long_press_triggered_) {
-            ESP_LOGI(kLogTag, "Short press (GPIO %d)", pin_);
-            if (short_press_cb_) {
-                short_press_cb_();
+}
+
+void IRAM_ATTR Button::arm_debounce() {
+    // Mask further edges until the level has settled
+    gpio_intr_disable(pin_);
+    edge_us_ = esp_timer_get_time();
+    esp_timer_start_once(debounce_timer_, (uint64_t)debounce_ms_ * 1000ULL);
+}
+
+void IRAM_ATTR Button::gpio_isr(void* arg) {
+    static_cast<Button*>(arg)->arm_debounce();
+}
+
+void Button::debounce_timer_cb(void* arg) {
+    Button* self = static_cast<Button*>(arg);
+    bool pressed = gpio_get_level(self->pin_) == 0;  // Active low
+    int64_t edge_us = self->edge_us_;
+
+    if (pressed != self->pressed_.load()) {
+        self->pressed_.store(pressed);
+
+        if (pressed) {
+            self->press_start_us_.store(edge_us);
+            self->long_press_triggered_ = false;
+            self->push_event(Event::Type::Press, edge_us);
+
+            // Long press threshold counts from the edge, not from debounce expiry
+            int64_t remaining_us = (int64_t)self->long_press_ms_ * 1000 - (esp_timer_get_time() - edge_us);
+            esp_timer_start_once(self->long_press_timer_, remaining_us > 0 ? (uint64_t)remaining_us : 1);
+        } else {
+            esp_timer_stop(self->long_press_timer_);
+            self->push_event(Event::Type::Release, edge_us);
+
+            // Only trigger short press if long press wasn't triggered
+            int64_t held_us = edge_us - self->press_start_us_.load();
+            if (!self->long_press_triggered_ && held_us < (int64_t)self->long_press_ms_ * 1000) {
+                self->push_event(Event::Type::ShortPress, edge_us);
             }
         }
     }
 
-    prev_state_ = pressed;
+    gpio_intr_enable(self->pin_);
+
+    // An edge may have arrived while the interrupt was masked
+    if ((gpio_get_level(self->pin_) == 0) != self->pressed_.load()) {
+        self->arm_debounce();
+    }
 }
 
-uint32_t Button::held_duration_ms() const {
-    if (!debounced_state_) {
-        return 0;
+void Button::long_press_timer_cb(void* arg) {
+    Button* self = static_cast<Button*>(arg);
+    if (self->pressed_.load() && !self->long_press_triggered_) {
+        self->long_press_triggered_ = true;
+        self->push_event(Event::Type::LongPress, esp_timer_get_time());
     }
-    uint32_t now_ms = (uint32_t)(esp_timer_get_time() / 1000ULL);
-    return now_ms - press_start_ms_;
 }
 
 } // namespace hardware
@@ -1,51 +1,96 @@
 #pragma once
 
+#include <atomic>
 #include <cstdint>
 #include <driver/gpio.h>
+#include <esp_timer.h>
+#include "util/spsc_queue.hpp"
 
 namespace hardware {
 
 /// Debounced button with short press and long press detection.
-/// Uses GPIO polling with configurable debounce time.
+/// Edges are caught by a GPIO interrupt and settled by esp_timer callbacks,
+/// so presses are never missed while the UI task is busy. Events carry the
+/// microsecond timestamp of the edge and are queued for the UI task, which
+/// drains them in update() and runs the short/long press callbacks.
 class Button {
 public:
     /// Callback type for button events
     using Callback = void(*)();
 
+    /// Button event delivered through the queue
+    struct Event {
+        enum class Type : uint8_t {
+            Press,       // Debounced press edge
+            Release,     // Debounced release edge
+            ShortPress,  // Released before long press threshold
+            LongPress,   // Held for long_press_ms
+        };
+        Type type;
+        int64_t timestamp_us;  // esp_timer time of the edge (or threshold for LongPress)
+    };
+
     /// Construct a button on the specified GPIO pin
     /// @param pin GPIO pin number (active low with internal pullup)
     /// @param debounce_ms Debounce time in milliseconds (default 100ms)
     /// @param long_press_ms Long press threshold in milliseconds (default 2000ms)
     explicit Button(gpio_num_t pin, uint32_t debounce_ms = 100, uint32_t long_press_ms = 2000);
 
-    /// Poll the button state (call from main loop)
+    /// Install the GPIO interrupt and timers (call once from setup, after boot)
+    void begin();
+
+    /// Drain queued events and run callbacks (call from the UI task)
     void update();
 
+    /// Pop the next raw event instead of using callbacks (UI task only)
+    /// @return false if no event is queued
+    bool poll_event(Event& out) { return events_.pop(out); }
+
     /// Set callback for short press events (released before long press threshold)
     void on_short_press(Callback cb) { short_press_cb_ = cb; }
 
     /// Set callback for long press events (held for long_press_ms)
     void on_long_press(Callback cb) { long_press_cb_ = cb; }
 
+    /// Set callback run whenever an event is queued (from timer context - keep it short)
+    void on_event_queued(Callback cb) { queued_cb_ = cb; }
+
     /// Get current debounced state
-    bool is_pressed() const { return debounced_state_; }
+    bool is_pressed() const { return pressed_.load(); }
 
     /// Get how long the button has been held (0 if not pressed)
     uint32_t held_duration_ms() const;
 
+    /// Number of events dropped because the queue was full
+    uint32_t dropped_events() const { return dropped_.load(); }
+
 private:
     gpio_num_t pin_;
     uint32_t debounce_ms_;
     uint32_t long_press_ms_;
 
-    bool debounced_state_ = false;
-    bool prev_state_ = false;
-    uint32_t last_change_ms_ = 0;
-    uint32_t press_start_ms_ = 0;
-    bool long_press_triggered_ = false;
+    esp_timer_handle_t debounce_timer_ = nullptr;
+    esp_timer_handle_t long_press_timer_ = nullptr;
+
+    // Written by ISR / esp_timer task, read by UI task
+    volatile int64_t edge_us_ = 0;
+    std::atomic<bool> pressed_{false};
+    std::atomic<int64_t> press_start_us_{0};
+    bool long_press_triggered_ = false;  // esp_timer task only
+    std::atomic<uint32_t> dropped_{0};
+
+    util::SpscQueue<Event, 16> events_;
 
     Callback short_press_cb_ = nullptr;
     Callback long_press_cb_ = nullptr;
+    Callback queued_cb_ = nullptr;
+
+    void push_event(Event::Type type, int64_t timestamp_us);
+    void arm_debounce();
+
+    static void gpio_isr(void* arg);
+    static void debounce_timer_cb(void* arg);
+    static void long_press_timer_cb(void* arg);
 };
 
 } // namespace hardware
@@ -11,7 +11,22 @@ namespace pins {
     /// Button A physical button on device (active low with internal pullup)
     constexpr gpio_num_t BUTTON_A = GPIO_NUM_42;
 
-    // Note: Rotary encoder (GPIO 40/41) is configured in m5dial_lvgl component
+    /// Rotary encoder quadrature inputs
+    /// (PCNT counting is configured in m5dial_lvgl component; used here for wake interrupts)
+    constexpr gpio_num_t ENCODER_A = GPIO_NUM_40;
+    constexpr gpio_num_t ENCODER_B = GPIO_NUM_41;
+
+    /// FT3267 touch controller interrupt (active low)
+    constexpr gpio_num_t TOUCH_INT = GPIO_NUM_14;
+}
+
+/// Main loop scheduling
+namespace loop {
+    /// Keep LVGL input polling alive this long after the last input event
+    constexpr uint32_t INPUT_IDLE_MS = 300;
+
+    /// Upper bound on a single sleep (the 1 Hz game tick wakes us anyway)
+    constexpr uint32_t MAX_SLEEP_MS = 1000;
 }
 
 /// Button timing configuration
@@ -23,6 +38,29 @@ namespace button {
     constexpr uint32_t LONG_PRESS_MS = 2000;
 }
 
+/// Boot configuration
+namespace boot {
+    /// Minimum time the splash image stays up (initialization runs behind it)
+    constexpr uint32_t SPLASH_MIN_MS = 1200;
+}
+
+/// Storage write-behind configuration
+namespace storage {
+    /// Pending writes are batched into one commit this long after the first one
+    constexpr uint32_t WRITE_DELAY_MS = 1000;
+
+    /// Longest power-off waits for pending writes to reach flash
+    constexpr uint32_t POWER_OFF_FLUSH_MS = 2000;
+}
+
+/// Screen transition configuration
+namespace screens {
+    /// Build each screen's widget tree once and hide/show it on transitions instead
+    /// of rebuilding it every time (trades resident LVGL heap for faster, churn-free
+    /// transitions). false restores the destroy/create behaviour.
+    constexpr bool CACHE_WIDGETS = true;
+}
+
 /// Audio feedback configuration
 namespace audio {
     /// Default tone duration for UI feedback sounds
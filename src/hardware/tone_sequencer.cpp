@@ -0,0 +1,96 @@
+#include "tone_sequencer.hpp"
+
+#include <M5Unified.hpp>
+#include <esp_log.h>
+
+namespace hardware {
+
+namespace {
+constexpr const char* kLogTag = "tone_sequencer";
+}
+
+ToneSequencer& ToneSequencer::instance() {
+    static ToneSequencer instance;
+    return instance;
+}
+
+void ToneSequencer::init() {
+    esp_timer_create_args_t args = {};
+    args.callback = timer_cb;
+    args.arg = this;
+    args.name = "tone_seq";
+    ESP_ERROR_CHECK(esp_timer_create(&args, &timer_));
+    ESP_LOGI(kLogTag, "Initialized");
+}
+
+void ToneSequencer::play(const Note* notes, size_t count) {
+    if (timer_ == nullptr || notes == nullptr || count == 0) {
+        return;
+    }
+    if (count > kMaxNotes) {
+        ESP_LOGW(kLogTag, "Sequence of %u notes truncated to %u", (unsigned)count, (unsigned)kMaxNotes);
+        count = kMaxNotes;
+    }
+
+    // Timer arming happens under lock_ in both play() and timer_cb(), so a callback
+    // still running for the old sequence cannot interleave with the swap
+    portENTER_CRITICAL(&lock_);
+    esp_timer_stop(timer_);
+    for (size_t i = 0; i < count; i++) {
+        notes_[i] = notes[i];
+    }
+    count_ = count;
+    index_ = 0;
+    // First note plays from the timer task as well, keeping M5.Speaker single-threaded
+    esp_timer_start_once(timer_, 1);
+    portEXIT_CRITICAL(&lock_);
+}
+
+void ToneSequencer::play_tone(float freq_hz, uint32_t duration_ms) {
+    Note note = {freq_hz, static_cast<uint16_t>(duration_ms), 0};
+    play(&note, 1);
+}
+
+void ToneSequencer::stop() {
+    if (timer_ == nullptr) {
+        return;
+    }
+    portENTER_CRITICAL(&lock_);
+    esp_timer_stop(timer_);
+    count_ = 0;
+    index_ = 0;
+    portEXIT_CRITICAL(&lock_);
+}
+
+bool ToneSequencer::is_playing() const {
+    if (timer_ != nullptr && esp_timer_is_active(timer_)) {
+        return true;
+    }
+    portENTER_CRITICAL(&lock_);
+    bool pending = index_ < count_;
+    portEXIT_CRITICAL(&lock_);
+    return pending;
+}
+
+void ToneSequencer::timer_cb(void* arg) {
+    ToneSequencer* self = static_cast<ToneSequencer*>(arg);
+
+    Note note;
+    bool has_note = false;
+    portENTER_CRITICAL(&self->lock_);
+    // An armed timer means play() replaced the sequence while this call was in
+    // flight: leave note 0 to the timer it started
+    if (!esp_timer_is_active(self->timer_) && self->index_ < self->count_) {
+        note = self->notes_[self->index_++];
+        has_note = true;
+        // Fires once more after the last note so is_playing() covers its duration
+        esp_timer_start_once(self->timer_, (uint64_t)(note.duration_ms + note.gap_ms) * 1000ULL);
+    }
+    portEXIT_CRITICAL(&self->lock_);
+
+    if (has_note && note.freq_hz > 0.0f) {
+        M5.Speaker.tone(note.freq_hz, note.duration_ms);
+    }
+}
+
+} // namespace hardware
@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+
+namespace hardware {
+
+/// Non-blocking tone player.
+/// Plays a short sequence of notes from an esp_timer callback so callers
+/// never wait on M5.delay(). Starting a new sequence replaces the one
+/// currently playing (same as M5.Speaker.tone() cutting the previous tone).
+/// All speaker tone calls go through here so only one context drives M5.Speaker.
+class ToneSequencer {
+public:
+    /// Single note: play freq_hz for duration_ms, then stay silent for gap_ms
+    struct Note {
+        float freq_hz;         // 0 = rest
+        uint16_t duration_ms;
+        uint16_t gap_ms;
+    };
+
+    /// Get the singleton instance
+    static ToneSequencer& instance();
+
+    /// Create the playback timer (call once after M5.begin())
+    void init();
+
+    /// Start playing a sequence (copied; the caller's array may go away)
+    /// @param notes Notes to play in order
+    /// @param count Number of notes (truncated to kMaxNotes)
+    void play(const Note* notes, size_t count);
+
+    /// Start playing a sequence from a fixed-size array
+    template <size_t N>
+    void play(const Note (&notes)[N]) { play(notes, N); }
+
+    /// Play a single tone
+    void play_tone(float freq_hz, uint32_t duration_ms);
+
+    /// Stop the current sequence after the note that is sounding
+    void stop();
+
+    /// Check if a sequence still has notes (or a note/gap) pending
+    bool is_playing() const;
+
+private:
+    ToneSequencer() = default;
+    ToneSequencer(const ToneSequencer&) = delete;
+    ToneSequencer& operator=(const ToneSequencer&) = delete;
+
+    static void timer_cb(void* arg);
+
+    static constexpr size_t kMaxNotes = 8;
+
+    esp_timer_handle_t timer_ = nullptr;
+    mutable portMUX_TYPE lock_ = portMUX_INITIALIZER_UNLOCKED;
+    Note notes_[kMaxNotes] = {};
+    size_t count_ = 0;
+    size_t index_ = 0;
+};
+
+} // namespace hardware
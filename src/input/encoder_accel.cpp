@@ -0,0 +1,62 @@
+#include "encoder_accel.hpp"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace encoder_input
+{
+int EncoderAccel::apply(int diff, int64_t now_us)
+{
+    if (diff == 0)
+    {
+        return 0;
+    }
+
+    int direction = (diff > 0) ? 1 : -1;
+    int detents = std::abs(diff);
+    int64_t dt_us = now_us - last_us_;
+
+    // A pause or change of direction always starts precise again
+    if (last_us_ < 0 || dt_us > kIdleResetUs || direction != last_direction_)
+    {
+        velocity_dps_ = 0.0f;
+    }
+    else
+    {
+        float sample = detents * 1000000.0f / static_cast<float>(dt_us > 0 ? dt_us : 1);
+        velocity_dps_ = (velocity_dps_ == 0.0f) ? sample : velocity_dps_ + kSmoothing * (sample - velocity_dps_);
+    }
+
+    last_us_ = now_us;
+    last_direction_ = direction;
+
+    int steps = static_cast<int>(detents * multiplier(velocity_dps_) + 0.5f);
+    if (steps < 1)
+    {
+        steps = 1;
+    }
+    return direction * steps;
+}
+
+void EncoderAccel::reset()
+{
+    velocity_dps_ = 0.0f;
+    last_us_ = -1;
+    last_direction_ = 0;
+}
+
+float EncoderAccel::multiplier(float velocity_dps) const
+{
+    if (velocity_dps <= curve_.threshold_dps)
+    {
+        return 1.0f;
+    }
+    if (velocity_dps >= curve_.saturation_dps)
+    {
+        return curve_.max_multiplier;
+    }
+
+    float t = (velocity_dps - curve_.threshold_dps) / (curve_.saturation_dps - curve_.threshold_dps);
+    return 1.0f + (curve_.max_multiplier - 1.0f) * std::pow(t, curve_.exponent);
+}
+}
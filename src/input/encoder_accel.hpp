@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstdint>
+
+namespace encoder_input
+{
+/// Maps encoder rotation speed (detents per second) to a step multiplier.
+/// Below threshold every detent is one step; between threshold and saturation
+/// the multiplier ramps up along (v - threshold)/(saturation - threshold)^exponent.
+struct AccelCurve
+{
+    float threshold_dps;   // Speed where acceleration starts
+    float saturation_dps;  // Speed where max_multiplier is reached
+    float max_multiplier;  // Steps per detent at full speed
+    float exponent;        // 1 = linear ramp, >1 = gentler start
+};
+
+/// Default curve for value-entry screens
+constexpr AccelCurve kDefaultAccelCurve = {4.0f, 24.0f, 5.0f, 2.0f};
+
+/// Volume (0-10 scale): gentle, at most 2 steps per detent on a fast spin
+constexpr AccelCurve kVolumeAccelCurve = {4.0f, 20.0f, 2.0f, 1.0f};
+
+/// Velocity-based encoder acceleration.
+/// Feed every encoder delta with its timestamp; get back the signed number
+/// of value steps to apply. Slow turns stay one step per detent.
+class EncoderAccel
+{
+public:
+    explicit EncoderAccel(const AccelCurve &curve = kDefaultAccelCurve) : curve_(curve) {}
+
+    /// Convert an encoder delta into value steps
+    /// @param diff Raw encoder delta (detents, signed)
+    /// @param now_us Timestamp of the delta in microseconds
+    /// @return Signed step count (0 only if diff is 0)
+    int apply(int diff, int64_t now_us);
+
+    /// Forget the rotation history (call when a screen is entered)
+    void reset();
+
+    /// Step multiplier for a given rotation speed
+    float multiplier(float velocity_dps) const;
+
+    /// Current smoothed rotation speed in detents per second
+    float velocity() const { return velocity_dps_; }
+
+private:
+    AccelCurve curve_;
+    float velocity_dps_ = 0.0f;
+    int64_t last_us_ = -1;
+    int last_direction_ = 0;
+
+    static constexpr int64_t kIdleResetUs = 250000;  // Pause that restarts from slow
+    static constexpr float kSmoothing = 0.5f;        // EWMA weight of the newest sample
+};
+}
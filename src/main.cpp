@@ -4,6 +4,9 @@
 #include <M5Unified.hpp>
 #include <lvgl.h>
 #include <esp_log.h>
+#include <esp_timer.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 
 #include "M5Dial-LVGL.h"
 #include "ui/ui_root.hpp"
@@ -11,10 +14,16 @@
 #include "input/encoder_input.hpp"
 #include "hardware/button.hpp"
 #include "hardware/encoder.hpp"
+#include "hardware/tone_sequencer.hpp"
 #include "hardware/config.hpp"
 #include "screens/screen_manager.hpp"
 #include "screens/small_blind_screen.hpp"
+#include "screens/game_active_screen.hpp"
+#include "game_state.hpp"
 #include "storage/nvs_storage.hpp"
+#include "storage/game_log.hpp"
+#include "storage/storage_writer.hpp"
+#include "tasks/event_loop.hpp"
 
 static const char *TAG = "poker_chip";
 
@@ -25,59 +34,110 @@ static hardware::Button g_btnA(
     hardware::config::button::LONG_PRESS_MS
 );
 
-extern const uint8_t _binary_src_images_riccy_png_start[];
-extern const uint8_t _binary_src_images_riccy_png_end[];
-
-void setup()
+// Boot phase timestamps (esp_timer microseconds since start), logged once at the end of setup
+struct BootTimeline
 {
-    ESP_LOGI(TAG, "Program starting");
-
-    M5.begin();
-
-    // Load saved volume from NVS and apply (0-10 scale -> 0-255 M5.Speaker range)
+    int64_t m5_ready = 0;     // M5.begin() done
+    int64_t splash = 0;       // Splash drawn
+    int64_t volume = 0;       // NVS initialized, volume loaded and applied (boot audio task)
+    int64_t jingle = 0;       // Startup jingle started (boot audio task)
+    int64_t lvgl = 0;         // LVGL display/input ports up
+    int64_t ui = 0;           // UI root, assets, input and hardware callbacks ready
+    int64_t screen = 0;       // First screen widgets built
+    int64_t splash_done = 0;  // Splash minimum time elapsed
+    int64_t first_frame = 0;  // First LVGL frame on the display
+};
+
+static BootTimeline s_boot;
+static TaskHandle_t s_setup_task = nullptr;
+static bool s_resumed = false;  // Game restored from the RTC snapshot (quiet, no splash)
+
+// Runs on the other core while setup() draws the splash and builds the UI
+static void boot_audio_task(void *)
+{
+    // Open storage once for the app's lifetime, then apply the saved volume (0-10 scale -> 0-255 M5.Speaker range)
+    storage::NVSStorage::instance().init();
+    storage::GameLog::instance().init();
+    storage::StorageWriter::instance().init();
     uint8_t volume = storage::NVSStorage::instance().load_volume(5);
     uint8_t speaker_volume = (volume * 255) / 10;
     M5.Speaker.setVolume(speaker_volume);
+    s_boot.volume = esp_timer_get_time();
     ESP_LOGI(TAG, "Loaded volume: %d (speaker: %d/255)", volume, speaker_volume);
 
-    M5.Display.fillScreen(TFT_BLACK);
-
-    // Show splash screen
-    const uint8_t *splash_data = _binary_src_images_riccy_png_start;
-    const size_t splash_size = static_cast<size_t>(_binary_src_images_riccy_png_end - _binary_src_images_riccy_png_start);
-    if (!M5.Display.drawPng(splash_data, splash_size, 0, 0))
+    // Startup sound sequence (G6 → D7 → C8 - "Pow-er-Up!")
+    static constexpr hardware::ToneSequencer::Note kStartupTones[] = {
+        {1568.0f, 80, 0},  // G6
+        {2349.0f, 80, 0},  // D7
+        {4186.0f, 120, 0}  // C8
+    };
+    if (!s_resumed)
     {
-        ESP_LOGW(TAG, "Failed to draw embedded splash image");
+        hardware::ToneSequencer::instance().play(kStartupTones);
     }
+    s_boot.jingle = esp_timer_get_time();
 
-    // Startup sound sequence (G6 → D7 → C8 - "Pow-er-Up!")
-    const uint32_t tone1 = 80;
-    const uint32_t tone2 = 80;
-    const uint32_t tone3 = 120;
-
-    M5.Speaker.tone(1568.0f, tone1);  // G6
-    M5.delay(tone1);
-    M5.Speaker.tone(2349.0f, tone2);  // D7
-    M5.delay(tone2);
-    M5.Speaker.tone(4186.0f, tone3);  // C8
-    const uint32_t elapsed = tone1 + tone2 + tone3;
-    if (elapsed < 2000)
+    // Worst case is the first boot after an upgrade (LittleFS format + record migration)
+    ESP_LOGI(TAG, "Boot task stack headroom: %u bytes", (unsigned)uxTaskGetStackHighWaterMark(nullptr));
+    xTaskNotifyGive(s_setup_task);
+    vTaskDelete(nullptr);
+}
+
+static void log_boot_timeline()
+{
+    auto ms = [](int64_t us) { return (unsigned long)(us / 1000); };
+    ESP_LOGI(TAG, "Boot (ms since start): m5=%lu splash=%lu volume=%lu jingle=%lu lvgl=%lu ui=%lu screen=%lu splash_done=%lu first_frame=%lu",
+             ms(s_boot.m5_ready), ms(s_boot.splash), ms(s_boot.volume), ms(s_boot.jingle), ms(s_boot.lvgl),
+             ms(s_boot.ui), ms(s_boot.screen), ms(s_boot.splash_done), ms(s_boot.first_frame));
+    // Full-screen refresh through the DMA flush pipeline (render + SPI transfer)
+    ESP_LOGI(TAG, "First frame refresh: %lu us", (unsigned long)disp_last_frame_us());
+}
+
+void setup()
+{
+    ESP_LOGI(TAG, "Program starting");
+
+    M5.begin();
+    hardware::ToneSequencer::instance().init();
+    s_boot.m5_ready = esp_timer_get_time();
+
+    // A game interrupted by a brownout/watchdog/panic comes straight back, paused
+    const bool resumed = GameState::instance().restore_snapshot();
+    s_resumed = resumed;
+
+    // NVS, volume and the jingle run alongside the splash and UI setup below
+    s_setup_task = xTaskGetCurrentTaskHandle();
+    xTaskCreatePinnedToCore(boot_audio_task, "boot_audio", 4096, nullptr, 5, nullptr, portNUM_PROCESSORS - 1);
+
+    // Show splash screen (pre-decoded at build time, covers the whole panel)
+    if (!resumed)
     {
-        M5.delay(2000 - elapsed);
+        if (!ui::assets::draw_splash(0, 0))
+        {
+            ESP_LOGW(TAG, "Failed to draw embedded splash image");
+        }
+        ESP_LOGI(TAG, "Splash drawn in %lu us", (unsigned long)(esp_timer_get_time() - s_boot.m5_ready));
     }
-    M5.Display.fillScreen(TFT_BLACK);
+    s_boot.splash = esp_timer_get_time();
 
-    // Initialize LVGL and UI
+    // Initialize LVGL and UI while the splash is showing.
+    // Nothing reaches the panel until LVGL's first refresh below.
     m5dial_lvgl_init(false);
+    s_boot.lvgl = esp_timer_get_time();
     ui::ui_init();
     ui::assets::init();
     encoder_input::init(ui::get().focus_proxy);
 
     // Initialize hardware modules
+    g_btnA.begin();
+    g_btnA.on_event_queued([]() {
+        tasks::EventLoop::instance().notify(tasks::EventLoop::kWakeButton);
+    });
     g_btnA.on_short_press([]() {
         ScreenManager::instance().handle_button_click();
     });
     g_btnA.on_long_press([]() {
+        storage::StorageWriter::instance().flush(hardware::config::storage::POWER_OFF_FLUSH_MS);
         M5.Power.powerOff();
     });
 
@@ -85,22 +145,94 @@ void setup()
         ScreenManager::instance().handle_encoder(delta);
     });
 
-    // Show logo and start with small blind screen
+    s_boot.ui = esp_timer_get_time();
+
+    // Screens read the game log (a resumed game journals its number), so storage must be up first
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    // Show logo and start with small blind screen (or the resumed game)
     lv_obj_clear_flag(ui::get().logo, LV_OBJ_FLAG_HIDDEN);
     ScreenManager::instance().init();
-    ScreenManager::instance().transition_to(&SmallBlindScreen::instance());
+    if (resumed)
+    {
+        ScreenManager::instance().transition_to(&GameActiveScreen::instance());
+    }
+    else
+    {
+        ScreenManager::instance().transition_to(&SmallBlindScreen::instance());
+    }
+    s_boot.screen = esp_timer_get_time();
+
+    // Hold the splash only for what is left of its minimum display time
+    int64_t splash_shown_ms = (esp_timer_get_time() - s_boot.splash) / 1000;
+    if (!resumed && splash_shown_ms < hardware::config::boot::SPLASH_MIN_MS)
+    {
+        M5.delay(hardware::config::boot::SPLASH_MIN_MS - splash_shown_ms);
+    }
+    s_boot.splash_done = esp_timer_get_time();
+
+    // Replace the splash with the first screen right away
+    lv_refr_now(nullptr);
+    s_boot.first_frame = esp_timer_get_time();
+
+    // Wake the loop from input interrupts and the 1 Hz game tick
+    tasks::EventLoop::instance().init();
+
+    log_boot_timeline();
 }
 
 void loop()
 {
+    namespace loop_cfg = hardware::config::loop;
+    static uint32_t sleep_ms = 0;
+    static uint32_t last_input_ms = 0;
+
+    auto& events = tasks::EventLoop::instance();
+    uint32_t wake = events.wait(sleep_ms);
+
     M5.update();
-    m5dial_lvgl_next();
+    uint32_t now_ms = M5.millis();
+
+    // Input arrived: read LVGL input devices right away instead of on their next poll
+    if (wake & tasks::EventLoop::kWakeInput)
+    {
+        last_input_ms = now_ms;
+        m5dial_lvgl_wake_input();
+    }
 
-    // Update hardware modules
+    // Dispatch queued button events
     g_btnA.update();
 
-    // Update active screen
-    ScreenManager::instance().tick();
+    // Advance active screen once per elapsed game second
+    for (uint32_t ticks = events.take_game_ticks(); ticks > 0; ticks--)
+    {
+        ScreenManager::instance().tick();
+    }
 
-    M5.delay(5);
+    // Stop polling input devices once everything has been quiet for a while
+    bool input_active = M5.Touch.getCount() > 0 || g_btnA.is_pressed();
+    if (input_active)
+    {
+        last_input_ms = now_ms;
+    }
+    else if (now_ms - last_input_ms >= loop_cfg::INPUT_IDLE_MS)
+    {
+        m5dial_lvgl_idle_input();
+    }
+
+    // Sleep until the next LVGL timer is due
+    sleep_ms = m5dial_lvgl_service();
+    if (sleep_ms > loop_cfg::MAX_SLEEP_MS)
+    {
+        sleep_ms = loop_cfg::MAX_SLEEP_MS;
+    }
+
+    static uint32_t last_stats_ms = 0;
+    if (now_ms - last_stats_ms >= 60000)
+    {
+        last_stats_ms = now_ms;
+        events.log_counters();
+        storage::NVSStorage::instance().log_stats();
+        storage::StorageWriter::instance().log_stats();
+    }
 }
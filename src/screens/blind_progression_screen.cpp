@@ -21,7 +21,7 @@ BlindProgressionScreen& BlindProgressionScreen::instance() {
 void BlindProgressionScreen::create_widgets() {
     ESP_LOGI(kLogTag, "Creating widgets");
 
-    lv_obj_t* scr = lv_scr_act();
+    lv_obj_t* scr = root();
 
     // Title background banner
     title_bg_ = lv_obj_create(scr);
@@ -36,21 +36,17 @@ void BlindProgressionScreen::create_widgets() {
 
     // Mode name (replaces big_number for this screen)
     mode_name_ = lv_label_create(scr);
-    lv_obj_set_style_text_font(mode_name_, &lv_font_montserrat_24, LV_PART_MAIN);
-    lv_obj_set_style_text_color(mode_name_, lv_color_hex(0xFF00DC), LV_PART_MAIN);
-    lv_obj_set_style_text_align(mode_name_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::styles::apply_option_name(mode_name_);
     lv_obj_align(mode_name_, LV_ALIGN_CENTER, 0, -25);
 
     // Mode description
     mode_description_ = lv_label_create(scr);
-    lv_obj_set_style_text_color(mode_description_, lv_color_hex(0xAAAAAA), LV_PART_MAIN);
-    lv_obj_set_style_text_align(mode_description_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::styles::apply_option_description(mode_description_);
     lv_obj_align(mode_description_, LV_ALIGN_CENTER, 0, -5);
 
     // Mode game time estimate
     mode_game_time_ = lv_label_create(scr);
-    lv_obj_set_style_text_color(mode_game_time_, lv_color_hex(0x777777), LV_PART_MAIN);
-    lv_obj_set_style_text_align(mode_game_time_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::styles::apply_hint_text(mode_game_time_);
     lv_obj_align(mode_game_time_, LV_ALIGN_CENTER, 0, 25);
 
     // Bottom button
@@ -81,27 +77,19 @@ void BlindProgressionScreen::create_widgets() {
     lv_label_set_text(info_title_, "Chip Breakdown");
 
     info_blue_ = lv_label_create(info_overlay_);
-    lv_label_set_text(info_blue_, "16 x Blue (25) = 400");
-    lv_obj_set_style_text_color(info_blue_, lv_color_hex(0x4488FF), LV_PART_MAIN);
-    lv_obj_set_style_text_align(info_blue_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::helpers::set_chip_line(info_blue_, 0);
     lv_obj_align(info_blue_, LV_ALIGN_CENTER, 0, -35);
 
     info_white_ = lv_label_create(info_overlay_);
-    lv_label_set_text(info_white_, "20 x White (50) = 1000");
-    lv_obj_set_style_text_color(info_white_, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
-    lv_obj_set_style_text_align(info_white_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::helpers::set_chip_line(info_white_, 1);
     lv_obj_align(info_white_, LV_ALIGN_CENTER, 0, -10);
 
     info_red_ = lv_label_create(info_overlay_);
-    lv_label_set_text(info_red_, "6 x Red (100) = 600");
-    lv_obj_set_style_text_color(info_red_, lv_color_hex(0xFF4444), LV_PART_MAIN);
-    lv_obj_set_style_text_align(info_red_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::helpers::set_chip_line(info_red_, 2);
     lv_obj_align(info_red_, LV_ALIGN_CENTER, 0, 15);
 
     info_stack_ = lv_label_create(info_overlay_);
-    lv_label_set_text(info_stack_, "Total stack: 2000");
-    lv_obj_set_style_text_color(info_stack_, lv_color_hex(0xCCCCCC), LV_PART_MAIN);
-    lv_obj_set_style_text_align(info_stack_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::helpers::set_stack_line(info_stack_);
     lv_obj_align(info_stack_, LV_ALIGN_CENTER, 0, 45);
 
     info_close_button_ = ui::helpers::create_button(info_overlay_);
@@ -114,6 +102,11 @@ void BlindProgressionScreen::create_widgets() {
     lv_obj_align(info_close_label_, LV_ALIGN_CENTER, 0, -12);
 
     lv_obj_add_flag(info_overlay_, LV_OBJ_FLAG_HIDDEN);
+
+    // Register event callbacks once per widget tree (cached trees keep them)
+    lv_obj_add_event_cb(info_overlay_, info_overlay_clicked_cb, LV_EVENT_CLICKED, this);
+    lv_obj_add_event_cb(info_close_button_, info_overlay_clicked_cb, LV_EVENT_CLICKED, this);
+    lv_obj_add_event_cb(bottom_button_, push_button_clicked_cb, LV_EVENT_CLICKED, this);
 }
 
 void BlindProgressionScreen::destroy_widgets() {
@@ -152,11 +145,6 @@ void BlindProgressionScreen::on_enter() {
     selection_ = 0;
     update_display();
 
-    // Setup event callbacks
-    lv_obj_add_event_cb(info_overlay_, info_overlay_clicked_cb, LV_EVENT_CLICKED, this);
-    lv_obj_add_event_cb(info_close_button_, info_overlay_clicked_cb, LV_EVENT_CLICKED, this);
-    lv_obj_add_event_cb(bottom_button_, push_button_clicked_cb, LV_EVENT_CLICKED, this);
-
     ESP_LOGI(kLogTag, "Initial selection: %s", kNames[selection_]);
 }
 
@@ -205,9 +193,11 @@ void BlindProgressionScreen::handle_button_click() {
     game.set_seconds_remaining(game.round_minutes() * 60);
 
     // Play confirmation tone (A7 → A7 double beep - climax, game starting!)
-    play_tone(3520.0f, 90);
-    M5.delay(60);
-    play_tone(3520.0f, 90);
+    static constexpr hardware::ToneSequencer::Note kTones[] = {
+        {3520.0f, 60, 0},
+        {3520.0f, 90, 0}
+    };
+    play_tones(kTones);
 
     // Transition to game active screen
     ScreenManager::instance().transition_to(&GameActiveScreen::instance());
@@ -275,18 +265,22 @@ void BlindProgressionScreen::show_info() {
     ESP_LOGI(kLogTag, "Showing info overlay");
     set_visible(info_overlay_, true);
     // F#7 → A7 chirp (playful upward)
-    play_tone(2794.0f, 40);  // F#7
-    M5.delay(40);
-    play_tone(3520.0f, 60);  // A7
+    static constexpr hardware::ToneSequencer::Note kTones[] = {
+        {2794.0f, 40, 0},  // F#7
+        {3520.0f, 60, 0}   // A7
+    };
+    play_tones(kTones);
 }
 
 void BlindProgressionScreen::hide_info() {
     ESP_LOGI(kLogTag, "Hiding info overlay");
     set_visible(info_overlay_, false);
     // A6 → F6 chirp (playful downward)
-    play_tone(1760.0f, 40);  // A6
-    M5.delay(40);
-    play_tone(1397.0f, 60);  // F6
+    static constexpr hardware::ToneSequencer::Note kTones[] = {
+        {1760.0f, 40, 0},  // A6
+        {1397.0f, 60, 0}   // F6
+    };
+    play_tones(kTones);
 }
 
 bool BlindProgressionScreen::is_modal_blocking() const {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "screen.hpp"
+#include "blind_schedule.hpp"
 
 /// Screen for selecting blind progression rate (TURBO/STANDARD/RELAXED).
 /// Displays choice name, description, and estimated game time.
@@ -39,8 +40,8 @@ private:
     lv_obj_t* info_close_button_ = nullptr;
     lv_obj_t* info_close_label_ = nullptr;
 
-    static constexpr int kOptionCount = 3;
-    static constexpr float kMultipliers[] = {1.5f, 2.0f, 1.25f};
+    static constexpr int kOptionCount = blinds::kModeCount;
+    static constexpr const float* kMultipliers = blinds::kMultipliers;
     static constexpr const char* kNames[] = {"STANDARD", "TURBO", "RELAXED"};
     static constexpr const char* kDescriptions[] = {
         "Blinds +50%/round",
@@ -48,8 +49,8 @@ private:
         "Blinds +25%/round"
     };
 
-    // Starting stack: 16×25 + 20×50 + 6×100 = 2000 chips
-    static constexpr int kStartingStack = 2000;
+    // Starting stack from the chip set (16×25 + 20×50 + 6×100 = 2000 by default)
+    static constexpr int kStartingStack = chips::starting_stack();
 
     // Sound feedback tones
     static constexpr float kToneUp = 2637.0f;      // E7 (high = increment)
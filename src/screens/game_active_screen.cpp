@@ -2,27 +2,52 @@
 
 #include <M5Unified.hpp>
 #include <esp_log.h>
+#include "blind_schedule.hpp"
 #include "game_state.hpp"
 #include "screen_manager.hpp"
 #include "small_blind_screen.hpp"
 #include "volume_screen.hpp"
 #include "game_logs_screen.hpp"
+#include "storage/event_journal.hpp"
 #include "storage/game_log.hpp"
+#include "storage/storage_writer.hpp"
+#include "hardware/config.hpp"
+#include "tasks/event_loop.hpp"
 #include "ui/ui_helpers.hpp"
 #include "ui/ui_styles.hpp"
 
 namespace {
 constexpr const char* kLogTag = "game_active_screen";
 
+using Note = hardware::ToneSequencer::Note;
+
 // Round transitions - ascending tension with tritone resolution!
-constexpr float kTransitionTones[] = {
-    2093.0f,  // C7   (base)
-    2489.0f,  // D#7  (minor 3rd up - tense)
-    2960.0f,  // G7   (tritone from C# - maximum tension!)
-    3520.0f   // A7   (resolution - higher climax!)
+// 130ms tones with a small 50ms gap between them
+constexpr Note kTransitionTones[] = {
+    {2093.0f, 130, 50},  // C7   (base)
+    {2489.0f, 130, 50},  // D#7  (minor 3rd up - tense)
+    {2960.0f, 130, 50},  // G7   (tritone from C# - maximum tension!)
+    {3520.0f, 130, 50}   // A7   (resolution - higher climax!)
+};
+
+// D6 → A6 arpeggio (retro menu open)
+constexpr Note kMenuOpenTones[] = {
+    {1175.0f, 40, 0},  // D6
+    {1760.0f, 70, 0}   // A6
+};
+
+// A6 → F6 downward chirp (dismiss menu)
+constexpr Note kMenuDismissTones[] = {
+    {1760.0f, 30, 0},  // A6
+    {1397.0f, 60, 0}   // F6
+};
+
+// C7 → E7 → G7 arpeggio (action executed)
+constexpr Note kActionTones[] = {
+    {2093.0f, 40, 0},  // C7
+    {2637.0f, 40, 0},  // E7
+    {2960.0f, 70, 0}   // G7
 };
-constexpr size_t kTransitionToneCount = sizeof(kTransitionTones) / sizeof(kTransitionTones[0]);
-constexpr uint32_t kTransitionToneDuration = 130;  // milliseconds
 }
 
 GameActiveScreen& GameActiveScreen::instance() {
@@ -32,7 +57,7 @@ GameActiveScreen& GameActiveScreen::instance() {
 
 void GameActiveScreen::create_widgets() {
     ESP_LOGI(kLogTag, "Creating widgets");
-    lv_obj_t* scr = lv_scr_act();
+    lv_obj_t* scr = root();
 
     // Title background
     title_bg_ = lv_obj_create(scr);
@@ -46,49 +71,43 @@ void GameActiveScreen::create_widgets() {
 
     // Small blind value and label
     small_blind_active_ = lv_label_create(scr);
-    lv_obj_set_style_text_font(small_blind_active_, &lv_font_montserrat_48, LV_PART_MAIN);
-    lv_obj_set_style_text_color(small_blind_active_, lv_color_hex(0x00FF46), LV_PART_MAIN);
-    lv_obj_set_style_text_align(small_blind_active_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::styles::apply_blind_value(small_blind_active_, ui::styles::Blind::Small);
     lv_obj_align(small_blind_active_, LV_ALIGN_CENTER, -60, -10);
 
     active_small_blind_label_ = lv_label_create(scr);
     lv_label_set_text(active_small_blind_label_, "Small\nBlind");
-    lv_obj_set_style_text_color(active_small_blind_label_, lv_color_hex(0x00FF46), LV_PART_MAIN);
-    lv_obj_set_style_text_align(active_small_blind_label_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::styles::apply_blind_label(active_small_blind_label_, ui::styles::Blind::Small);
     lv_obj_align(active_small_blind_label_, LV_ALIGN_CENTER, -60, -50);
 
     // Big blind value and label
     big_blind_active_ = lv_label_create(scr);
-    lv_obj_set_style_text_font(big_blind_active_, &lv_font_montserrat_48, LV_PART_MAIN);
-    lv_obj_set_style_text_color(big_blind_active_, lv_color_hex(0x00FBFF), LV_PART_MAIN);
-    lv_obj_set_style_text_align(big_blind_active_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::styles::apply_blind_value(big_blind_active_, ui::styles::Blind::Big);
     lv_obj_align(big_blind_active_, LV_ALIGN_CENTER, 60, -10);
 
     active_big_blind_label_ = lv_label_create(scr);
     lv_label_set_text(active_big_blind_label_, "Big\nBlind");
-    lv_obj_set_style_text_color(active_big_blind_label_, lv_color_hex(0x00FBFF), LV_PART_MAIN);
-    lv_obj_set_style_text_align(active_big_blind_label_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::styles::apply_blind_label(active_big_blind_label_, ui::styles::Blind::Big);
     lv_obj_align(active_big_blind_label_, LV_ALIGN_CENTER, 60, -50);
 
     // Timer (MM:SS)
     elapsed_mins_ = lv_label_create(scr);
-    lv_obj_set_style_text_font(elapsed_mins_, &lv_font_montserrat_48, LV_PART_MAIN);
-    lv_obj_set_style_text_color(elapsed_mins_, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
-    lv_obj_set_style_text_align(elapsed_mins_, LV_TEXT_ALIGN_RIGHT, LV_PART_MAIN);
+    ui::styles::apply_timer_text(elapsed_mins_, LV_TEXT_ALIGN_RIGHT);
     lv_obj_align(elapsed_mins_, LV_ALIGN_CENTER, -40, 40);
 
     timer_colon_ = lv_label_create(scr);
     lv_label_set_text(timer_colon_, ":");
-    lv_obj_set_style_text_font(timer_colon_, &lv_font_montserrat_48, LV_PART_MAIN);
-    lv_obj_set_style_text_color(timer_colon_, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    ui::styles::apply_timer_text(timer_colon_, LV_TEXT_ALIGN_AUTO);
     lv_obj_align(timer_colon_, LV_ALIGN_CENTER, 0, 40);
 
     elapsed_secs_ = lv_label_create(scr);
-    lv_obj_set_style_text_font(elapsed_secs_, &lv_font_montserrat_48, LV_PART_MAIN);
-    lv_obj_set_style_text_color(elapsed_secs_, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
-    lv_obj_set_style_text_align(elapsed_secs_, LV_TEXT_ALIGN_LEFT, LV_PART_MAIN);
+    ui::styles::apply_timer_text(elapsed_secs_, LV_TEXT_ALIGN_LEFT);
     lv_obj_align(elapsed_secs_, LV_ALIGN_CENTER, 40, 40);
 
+    // Colour-up note between the timer and the Menu button (hidden unless a chip leaves play)
+    colour_up_label_ = lv_label_create(scr);
+    lv_obj_align(colour_up_label_, LV_ALIGN_BOTTOM_MID, 0, -40);
+    set_visible(colour_up_label_, false);
+
     // Bottom Menu button
     bottom_button_ = ui::helpers::create_button(scr);
     ui::styles::apply_bottom_button(bottom_button_);
@@ -107,97 +126,76 @@ void GameActiveScreen::create_widgets() {
     // 2-line pause status display (60px total height for better visibility)
     menu_paused_label_ = lv_label_create(menu_overlay_);
     lv_label_set_text(menu_paused_label_, "Paused 0:00");
-    lv_obj_set_style_text_color(menu_paused_label_, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
-    lv_obj_set_style_text_align(menu_paused_label_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::styles::apply_status_text(menu_paused_label_);
     lv_obj_align(menu_paused_label_, LV_ALIGN_TOP_MID, 0, 15);
 
     menu_timers_label_ = lv_label_create(menu_overlay_);
     lv_label_set_text(menu_timers_label_, "Game: 0:00    Paused: 0:00");
-    lv_obj_set_style_text_color(menu_timers_label_, lv_color_hex(0xCCCCCC), LV_PART_MAIN);
-    lv_obj_set_style_text_align(menu_timers_label_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::styles::apply_detail_text(menu_timers_label_);
     lv_obj_align(menu_timers_label_, LV_ALIGN_TOP_MID, 0, 38);
 
     // Menu items - equal 30px height for all items with dividing lines
     // Timer area: 0-60, Menu area: 60-240 (180px for 6 items = 30px each)
     // Y positions: 60, 90, 120, 150, 180, 210
     menu_item_resume_ = ui::helpers::create_button(menu_overlay_);
-    lv_obj_set_size(menu_item_resume_, 240, 30);
     lv_obj_align(menu_item_resume_, LV_ALIGN_TOP_MID, 0, 60);
-    lv_obj_set_style_bg_color(menu_item_resume_, lv_color_hex(0x555555), LV_PART_MAIN);
-    lv_obj_set_style_radius(menu_item_resume_, 0, LV_PART_MAIN);
-    lv_obj_set_style_border_width(menu_item_resume_, 1, LV_PART_MAIN);
-    lv_obj_set_style_border_color(menu_item_resume_, lv_color_hex(0x333333), LV_PART_MAIN);
-    lv_obj_set_style_border_side(menu_item_resume_, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN);
+    ui::styles::apply_menu_item(menu_item_resume_, true);
     lv_obj_t* resume_label = lv_label_create(menu_item_resume_);
     lv_label_set_text(resume_label, "Resume");
-    lv_obj_set_style_text_align(resume_label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::styles::apply_centered_text(resume_label);
     lv_obj_center(resume_label);
 
     menu_item_skip_ = ui::helpers::create_button(menu_overlay_);
-    lv_obj_set_size(menu_item_skip_, 240, 30);
     lv_obj_align(menu_item_skip_, LV_ALIGN_TOP_MID, 0, 90);
-    lv_obj_set_style_bg_color(menu_item_skip_, lv_color_hex(0x555555), LV_PART_MAIN);
-    lv_obj_set_style_radius(menu_item_skip_, 0, LV_PART_MAIN);
-    lv_obj_set_style_border_width(menu_item_skip_, 1, LV_PART_MAIN);
-    lv_obj_set_style_border_color(menu_item_skip_, lv_color_hex(0x333333), LV_PART_MAIN);
-    lv_obj_set_style_border_side(menu_item_skip_, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN);
+    ui::styles::apply_menu_item(menu_item_skip_, true);
     lv_obj_t* skip_label = lv_label_create(menu_item_skip_);
     lv_label_set_text(skip_label, "Skip Round");
-    lv_obj_set_style_text_align(skip_label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::styles::apply_centered_text(skip_label);
     lv_obj_center(skip_label);
 
     menu_item_volume_ = ui::helpers::create_button(menu_overlay_);
-    lv_obj_set_size(menu_item_volume_, 240, 30);
     lv_obj_align(menu_item_volume_, LV_ALIGN_TOP_MID, 0, 120);
-    lv_obj_set_style_bg_color(menu_item_volume_, lv_color_hex(0x555555), LV_PART_MAIN);
-    lv_obj_set_style_radius(menu_item_volume_, 0, LV_PART_MAIN);
-    lv_obj_set_style_border_width(menu_item_volume_, 1, LV_PART_MAIN);
-    lv_obj_set_style_border_color(menu_item_volume_, lv_color_hex(0x333333), LV_PART_MAIN);
-    lv_obj_set_style_border_side(menu_item_volume_, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN);
+    ui::styles::apply_menu_item(menu_item_volume_, true);
     lv_obj_t* volume_label = lv_label_create(menu_item_volume_);
     lv_label_set_text(volume_label, "Volume");
-    lv_obj_set_style_text_align(volume_label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::styles::apply_centered_text(volume_label);
     lv_obj_center(volume_label);
 
     menu_item_logs_ = ui::helpers::create_button(menu_overlay_);
-    lv_obj_set_size(menu_item_logs_, 240, 30);
     lv_obj_align(menu_item_logs_, LV_ALIGN_TOP_MID, 0, 150);
-    lv_obj_set_style_bg_color(menu_item_logs_, lv_color_hex(0x555555), LV_PART_MAIN);
-    lv_obj_set_style_radius(menu_item_logs_, 0, LV_PART_MAIN);
-    lv_obj_set_style_border_width(menu_item_logs_, 1, LV_PART_MAIN);
-    lv_obj_set_style_border_color(menu_item_logs_, lv_color_hex(0x333333), LV_PART_MAIN);
-    lv_obj_set_style_border_side(menu_item_logs_, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN);
+    ui::styles::apply_menu_item(menu_item_logs_, true);
     lv_obj_t* logs_label = lv_label_create(menu_item_logs_);
     lv_label_set_text(logs_label, "Game Logs");
-    lv_obj_set_style_text_align(logs_label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::styles::apply_centered_text(logs_label);
     lv_obj_center(logs_label);
 
     menu_item_reset_ = ui::helpers::create_button(menu_overlay_);
-    lv_obj_set_size(menu_item_reset_, 240, 30);
     lv_obj_align(menu_item_reset_, LV_ALIGN_TOP_MID, 0, 180);
-    lv_obj_set_style_bg_color(menu_item_reset_, lv_color_hex(0x555555), LV_PART_MAIN);
-    lv_obj_set_style_radius(menu_item_reset_, 0, LV_PART_MAIN);
-    lv_obj_set_style_border_width(menu_item_reset_, 1, LV_PART_MAIN);
-    lv_obj_set_style_border_color(menu_item_reset_, lv_color_hex(0x333333), LV_PART_MAIN);
-    lv_obj_set_style_border_side(menu_item_reset_, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN);
+    ui::styles::apply_menu_item(menu_item_reset_, true);
     lv_obj_t* reset_label = lv_label_create(menu_item_reset_);
     lv_label_set_text(reset_label, "New Game");
-    lv_obj_set_style_text_align(reset_label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::styles::apply_centered_text(reset_label);
     lv_obj_center(reset_label);
 
     menu_item_poweroff_ = ui::helpers::create_button(menu_overlay_);
-    lv_obj_set_size(menu_item_poweroff_, 240, 30);
     lv_obj_align(menu_item_poweroff_, LV_ALIGN_TOP_MID, 0, 210);
-    lv_obj_set_style_bg_color(menu_item_poweroff_, lv_color_hex(0x555555), LV_PART_MAIN);
-    lv_obj_set_style_radius(menu_item_poweroff_, 0, LV_PART_MAIN);
-    lv_obj_set_style_border_width(menu_item_poweroff_, 0, LV_PART_MAIN);
+    ui::styles::apply_menu_item(menu_item_poweroff_, false);
     lv_obj_t* poweroff_label = lv_label_create(menu_item_poweroff_);
     lv_label_set_text(poweroff_label, "Power Off");
-    lv_obj_set_style_text_align(poweroff_label, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::styles::apply_centered_text(poweroff_label);
     lv_obj_center(poweroff_label);
 
     // Hide menu initially
     lv_obj_add_flag(menu_overlay_, LV_OBJ_FLAG_HIDDEN);
+
+    // Register event callbacks once per widget tree (cached trees keep them)
+    lv_obj_add_event_cb(bottom_button_, bottom_button_bg_clicked_cb, LV_EVENT_CLICKED, this);
+    lv_obj_add_event_cb(menu_item_resume_, menu_item_clicked_cb, LV_EVENT_CLICKED, this);
+    lv_obj_add_event_cb(menu_item_reset_, menu_item_clicked_cb, LV_EVENT_CLICKED, this);
+    lv_obj_add_event_cb(menu_item_skip_, menu_item_clicked_cb, LV_EVENT_CLICKED, this);
+    lv_obj_add_event_cb(menu_item_volume_, menu_item_clicked_cb, LV_EVENT_CLICKED, this);
+    lv_obj_add_event_cb(menu_item_logs_, menu_item_clicked_cb, LV_EVENT_CLICKED, this);
+    lv_obj_add_event_cb(menu_item_poweroff_, menu_item_clicked_cb, LV_EVENT_CLICKED, this);
 }
 
 void GameActiveScreen::destroy_widgets() {
@@ -213,6 +211,7 @@ void GameActiveScreen::destroy_widgets() {
     if (elapsed_mins_) { lv_obj_del(elapsed_mins_); elapsed_mins_ = nullptr; }
     if (elapsed_secs_) { lv_obj_del(elapsed_secs_); elapsed_secs_ = nullptr; }
     if (timer_colon_) { lv_obj_del(timer_colon_); timer_colon_ = nullptr; }
+    if (colour_up_label_) { lv_obj_del(colour_up_label_); colour_up_label_ = nullptr; }
     if (bottom_button_) { lv_obj_del(bottom_button_); bottom_button_ = nullptr; }
     if (menu_label_) { menu_label_ = nullptr; }  // Child of bottom_button_
 
@@ -231,28 +230,28 @@ void GameActiveScreen::destroy_widgets() {
 void GameActiveScreen::on_enter() {
     ESP_LOGI(kLogTag, "Entering screen");
 
-    last_tick_ms_ = M5.millis();
-
-    // Register touch events for menu items
-    lv_obj_add_event_cb(bottom_button_, bottom_button_bg_clicked_cb, LV_EVENT_CLICKED, this);
-    lv_obj_add_event_cb(menu_item_resume_, menu_item_clicked_cb, LV_EVENT_CLICKED, this);
-    lv_obj_add_event_cb(menu_item_reset_, menu_item_clicked_cb, LV_EVENT_CLICKED, this);
-    lv_obj_add_event_cb(menu_item_skip_, menu_item_clicked_cb, LV_EVENT_CLICKED, this);
-    lv_obj_add_event_cb(menu_item_volume_, menu_item_clicked_cb, LV_EVENT_CLICKED, this);
-    lv_obj_add_event_cb(menu_item_logs_, menu_item_clicked_cb, LV_EVENT_CLICKED, this);
-    lv_obj_add_event_cb(menu_item_poweroff_, menu_item_clicked_cb, LV_EVENT_CLICKED, this);
-
     // Update displays with initial values
     update_round_title();
     update_blind_display();
     update_timer_display();
+    update_colour_up_note();
 
     // Reset state
     paused_ = false;
     menu_selection_ = 0;
 
-    // Start game timer
-    GameState::instance().start_game_timer();
+    if (GameState::instance().is_timer_paused()) {
+        // Game already in progress (resumed after a reset):
+        // keep its totals and come back to the pause menu
+        storage::EventJournal::instance().record_game_number(storage::GameLog::instance().game_number());
+        paused_ = true;
+        show_menu();
+    } else {
+        // Start game timer and a fresh game log entry; the first second counts from now
+        GameState::instance().start_game_timer();
+        tasks::EventLoop::instance().restart_game_tick();
+        storage::GameLog::instance().begin_game();
+    }
 
     ESP_LOGI(kLogTag, "Game started: Round %d, SB=%d, BB=%d, Time=%ds",
              GameState::instance().current_round(),
@@ -263,6 +262,18 @@ void GameActiveScreen::on_enter() {
 
 void GameActiveScreen::on_exit() {
     ESP_LOGI(kLogTag, "Exiting screen");
+
+    // New Game leaves with the menu open; a cached tree must not come back with it
+    hide_menu();
+}
+
+void GameActiveScreen::on_resume() {
+    ESP_LOGI(kLogTag, "Back from covering screen");
+
+    // Everything else is as it was left; only the paused-for time has moved on
+    if (paused_) {
+        update_paused_note();
+    }
 }
 
 void GameActiveScreen::handle_encoder(int diff) {
@@ -296,34 +307,20 @@ void GameActiveScreen::handle_button_click() {
         paused_ = true;
         GameState::instance().pause_game_timer();
         show_menu();
-        // D6 → A6 arpeggio (retro menu open)
-        play_tone(1175.0f, 50);  // D6
-        M5.delay(40);
-        play_tone(1760.0f, 70);  // A6
+        play_tones(kMenuOpenTones);
     }
 }
 
 void GameActiveScreen::tick() {
-    uint32_t now_ms = M5.millis();
-
-    // Check if 1 second has elapsed
-    if (now_ms - last_tick_ms_ < kTickIntervalMs) {
-        return;
-    }
-
-    last_tick_ms_ = now_ms;
-
     auto& game = GameState::instance();
 
     if (paused_) {
         // When paused, update pause menu display every second
+        game.checkpoint();
         update_paused_note();
         return;
     }
 
-    // Increment game timer
-    game.tick_game_timer();
-
     if (game.seconds_remaining() > 0) {
         int new_seconds = game.decrement_seconds();
         update_timer_display();
@@ -359,31 +356,48 @@ void GameActiveScreen::update_round_title() {
     lv_label_set_text_fmt(title_, "Round %d", game.current_round());
 }
 
+void GameActiveScreen::update_colour_up_note() {
+    auto& game = GameState::instance();
+    blinds::Mode mode = blinds::mode_for_multiplier(game.blind_multiplier());
+    uint32_t colour_up = blinds::colour_up_mask(mode, game.starting_small_blind(), game.current_round());
+    if (colour_up == 0) {
+        set_visible(colour_up_label_, false);
+        return;
+    }
+
+    // Shown for the whole round, in the colour of the smallest chip leaving play
+    char text[48];
+    int len = snprintf(text, sizeof(text), "Colour up:");
+    int first = -1;
+    for (int i = 0; i < chips::kDenominationCount; i++) {
+        if (colour_up & (1u << i)) {
+            ESP_LOGI(kLogTag, "Colour up: %s (%d) chips no longer needed",
+                     chips::kChipSet[i].name, chips::kChipSet[i].value);
+            if (len < static_cast<int>(sizeof(text))) {
+                len += snprintf(text + len, sizeof(text) - len, "%s %s", first < 0 ? "" : ",",
+                                chips::kChipSet[i].name);
+            }
+            if (first < 0) {
+                first = i;
+            }
+        }
+    }
+    lv_label_set_text(colour_up_label_, text);
+    ui::styles::apply_chip_line(colour_up_label_, first);
+    set_visible(colour_up_label_, true);
+}
+
 void GameActiveScreen::advance_round() {
     auto& game = GameState::instance();
 
     // Increment round
     game.set_current_round(game.current_round() + 1);
     game.record_max_round(game.current_round());
+    game.start_round_timer();
 
-    // Store previous blind for minimum increase check
-    int prev_small_blind = game.small_blind();
-
-    // Apply multiplier to small blind
-    float new_sb = game.small_blind() * game.blind_multiplier();
-
-    // Round to nearest 25
-    int new_small_blind = static_cast<int>((new_sb + 12.5f) / 25) * 25;
-
-    // Ensure minimum increase of 25
-    if (new_small_blind <= prev_small_blind) {
-        new_small_blind = prev_small_blind + 25;
-    }
-
-    // Apply failsafe
-    if (new_small_blind > kMaxBlind) {
-        new_small_blind = kMaxBlind;
-    }
+    // Look up the new level (rounded to the chip set, min one step, capped; see blind_schedule.hpp)
+    blinds::Mode mode = blinds::mode_for_multiplier(game.blind_multiplier());
+    int new_small_blind = blinds::small_blind_at(mode, game.starting_small_blind(), game.current_round());
 
     // Update blinds (big_blind automatically set to 2x small_blind)
     game.update_blinds(new_small_blind);
@@ -398,6 +412,7 @@ void GameActiveScreen::advance_round() {
     update_round_title();
     update_blind_display();
     update_timer_display();
+    update_colour_up_note();
 
     // Play transition tones
     play_round_transition_tones();
@@ -407,10 +422,7 @@ void GameActiveScreen::advance_round() {
 }
 
 void GameActiveScreen::play_round_transition_tones() {
-    for (size_t i = 0; i < kTransitionToneCount; i++) {
-        play_tone(kTransitionTones[i], kTransitionToneDuration);
-        M5.delay(kTransitionToneDuration + 50);  // Small gap between tones
-    }
+    play_tones(kTransitionTones);
 }
 
 void GameActiveScreen::show_menu() {
@@ -464,11 +476,11 @@ void GameActiveScreen::update_menu_selection() {
         // Re-center after text change
         lv_obj_center(label);
 
-        // Update colors based on selection
+        // Highlight the selection (shared style bound to LV_STATE_CHECKED)
         if (i == menu_selection_) {
-            lv_obj_set_style_bg_color(items[i], lv_color_hex(0x0088FF), LV_PART_MAIN);
+            lv_obj_add_state(items[i], LV_STATE_CHECKED);
         } else {
-            lv_obj_set_style_bg_color(items[i], lv_color_hex(0x555555), LV_PART_MAIN);
+            lv_obj_remove_state(items[i], LV_STATE_CHECKED);
         }
     }
 }
@@ -481,36 +493,11 @@ void GameActiveScreen::update_paused_note() {
     int round_secs = game.seconds_remaining() % 60;
     lv_label_set_text_fmt(menu_paused_label_, "Paused %d:%02d", round_mins, round_secs);
 
-    // Line 2: "Game: M:SS    Paused: M:SS" (both count up in real-time)
-    uint32_t game_secs = game.total_game_seconds();
-    int g_hours = game_secs / 3600;
-    int g_mins = (game_secs % 3600) / 60;
-    int g_secs = game_secs % 60;
-
-    // Calculate current paused time (base + current pause duration)
-    uint32_t current_paused_secs = game.total_paused_seconds();
-    if (game.pause_start_ms() != 0) {
-        uint32_t pause_duration_ms = M5.millis() - game.pause_start_ms();
-        current_paused_secs += pause_duration_ms / 1000;
-    }
-    int p_hours = current_paused_secs / 3600;
-    int p_mins = (current_paused_secs % 3600) / 60;
-    int p_secs = current_paused_secs % 60;
-
+    // Line 2: "Game: M:SS    Paused: M:SS" (both count up in real-time, including the pause in progress)
     char game_time_str[16];
     char paused_time_str[16];
-
-    if (g_hours > 0) {
-        snprintf(game_time_str, sizeof(game_time_str), "%d:%02d:%02d", g_hours, g_mins, g_secs);
-    } else {
-        snprintf(game_time_str, sizeof(game_time_str), "%d:%02d", g_mins, g_secs);
-    }
-
-    if (p_hours > 0) {
-        snprintf(paused_time_str, sizeof(paused_time_str), "%d:%02d:%02d", p_hours, p_mins, p_secs);
-    } else {
-        snprintf(paused_time_str, sizeof(paused_time_str), "%d:%02d", p_mins, p_secs);
-    }
+    GameState::format_duration(game.active_us(), game_time_str, sizeof(game_time_str));
+    GameState::format_duration(game.paused_us(), paused_time_str, sizeof(paused_time_str));
 
     lv_label_set_text_fmt(menu_timers_label_, "Game: %s    Paused: %s", game_time_str, paused_time_str);
 }
@@ -521,11 +508,9 @@ void GameActiveScreen::execute_menu_action() {
     switch (menu_selection_) {
         case 0:  // Resume
             ESP_LOGI(kLogTag, "Resuming game");
-            // A6 → F6 downward chirp (dismiss menu)
-            play_tone(1760.0f, 40);
-            M5.delay(30);
-            play_tone(1397.0f, 60);
+            play_tones(kMenuDismissTones);
             GameState::instance().resume_game_timer();
+            tasks::EventLoop::instance().restart_game_tick();
             paused_ = false;
             hide_menu();
             break;
@@ -533,6 +518,11 @@ void GameActiveScreen::execute_menu_action() {
         case 1:  // Skip Round
             ESP_LOGI(kLogTag, "Skipping to next round");
             // No confirmation sound - round transition tones will play
+            // Journal: Pause -> Skip -> RoundStart (the skip resumes the clock)
+            storage::EventJournal::instance().record(storage::JournalEvent::Skip,
+                                                     GameState::instance().current_round());
+            GameState::instance().resume_game_timer(false);
+            tasks::EventLoop::instance().restart_game_tick();
             paused_ = false;
             hide_menu();
             advance_round();
@@ -540,46 +530,29 @@ void GameActiveScreen::execute_menu_action() {
 
         case 2:  // Volume
             ESP_LOGI(kLogTag, "Opening volume screen");
-            // C7 → E7 → G7 arpeggio (action executed)
-            play_tone(2093.0f, 50);  // C7
-            M5.delay(40);
-            play_tone(2637.0f, 50);  // E7
-            M5.delay(40);
-            play_tone(2960.0f, 70);  // G7
-            paused_ = false;
-            hide_menu();
-            ScreenManager::instance().transition_to(&VolumeScreen::instance());
+            play_tones(kActionTones);
+            // Covers the paused game; popping back reveals the menu as it was
+            ScreenManager::instance().push(&VolumeScreen::instance());
             break;
 
         case 3:  // Game Logs
             ESP_LOGI(kLogTag, "Opening game logs screen");
-            // C7 → E7 → G7 arpeggio (action executed)
-            play_tone(2093.0f, 50);  // C7
-            M5.delay(40);
-            play_tone(2637.0f, 50);  // E7
-            M5.delay(40);
-            play_tone(2960.0f, 70);  // G7
-            paused_ = false;
-            hide_menu();
-            ScreenManager::instance().transition_to(&GameLogsScreen::instance());
+            play_tones(kActionTones);
+            ScreenManager::instance().push(&GameLogsScreen::instance());
             break;
 
         case 4:  // New Game
             ESP_LOGI(kLogTag, "Resetting to small blind screen");
-            // C7 → E7 → G7 arpeggio (action executed)
-            play_tone(2093.0f, 50);  // C7
-            M5.delay(40);
-            play_tone(2637.0f, 50);  // E7
-            M5.delay(40);
-            play_tone(2960.0f, 70);  // G7
+            play_tones(kActionTones);
             GameState::instance().reset();
             ScreenManager::instance().transition_to(&SmallBlindScreen::instance());
             break;
 
         case 5:  // Power Off
             ESP_LOGI(kLogTag, "Powering off");
-            // Save game log before powering off
+            // Save game log and wait for it to reach flash before powering off
             storage::GameLog::instance().save_current_game();
+            storage::StorageWriter::instance().flush(hardware::config::storage::POWER_OFF_FLUSH_MS);
             M5.Power.powerOff();
             break;
     }
@@ -591,10 +564,7 @@ void GameActiveScreen::bottom_button_bg_clicked_cb(lv_event_t* e) {
         screen->paused_ = true;
         GameState::instance().pause_game_timer();
         screen->show_menu();
-        // D6 → A6 arpeggio (retro menu open)
-        screen->play_tone(1175.0f, 50);  // D6
-        M5.delay(40);
-        screen->play_tone(1760.0f, 70);  // A6
+        screen->play_tones(kMenuOpenTones);
     }
 }
 
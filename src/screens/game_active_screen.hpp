@@ -16,6 +16,7 @@ public:
     void destroy_widgets() override;
     void on_enter() override;
     void on_exit() override;
+    void on_resume() override;
     void handle_encoder(int diff) override;
     void handle_button_click() override;
     void tick() override;
@@ -34,6 +35,7 @@ private:
     lv_obj_t* elapsed_mins_ = nullptr;
     lv_obj_t* elapsed_secs_ = nullptr;
     lv_obj_t* timer_colon_ = nullptr;
+    lv_obj_t* colour_up_label_ = nullptr;          // "Colour up: Blue" while a chip leaves play
     lv_obj_t* bottom_button_ = nullptr;
     lv_obj_t* menu_label_ = nullptr;
 
@@ -48,18 +50,16 @@ private:
     lv_obj_t* menu_item_reset_ = nullptr;
     lv_obj_t* menu_item_poweroff_ = nullptr;
 
-    uint32_t last_tick_ms_ = 0;
     bool paused_ = false;
     int menu_selection_ = 0;  // 0=Resume, 1=Skip, 2=Volume, 3=Logs, 4=NewGame, 5=PowerOff
 
-    static constexpr uint32_t kTickIntervalMs = 1000;  // 1 second
-    static constexpr int kMaxBlind = 9999;             // Failsafe
     static constexpr int kMenuItemCount = 6;
     static constexpr int kPowerOffLabelYOffset = -20;  // Y offset for power off label
 
     void update_timer_display();
     void update_blind_display();
     void update_round_title();
+    void update_colour_up_note();
     void advance_round();
     void play_round_transition_tones();
 
@@ -3,7 +3,7 @@
 #include <M5Unified.hpp>
 #include <esp_log.h>
 #include "screen_manager.hpp"
-#include "game_active_screen.hpp"
+#include "game_state.hpp"
 #include "ui/ui_helpers.hpp"
 #include "ui/ui_styles.hpp"
 
@@ -19,7 +19,7 @@ GameLogsScreen& GameLogsScreen::instance() {
 void GameLogsScreen::create_widgets() {
     ESP_LOGI(kLogTag, "Creating widgets");
 
-    lv_obj_t* scr = lv_scr_act();
+    lv_obj_t* scr = root();
 
     // Title background banner
     title_bg_ = lv_obj_create(scr);
@@ -35,8 +35,7 @@ void GameLogsScreen::create_widgets() {
     // Create 5 labels for game entries (scrollable)
     for (int i = 0; i < kVisibleGames; i++) {
         log_labels_[i] = lv_label_create(scr);
-        lv_obj_set_style_text_color(log_labels_[i], lv_color_hex(0xAAAAAA), LV_PART_MAIN);
-        lv_obj_set_style_text_align(log_labels_[i], LV_TEXT_ALIGN_LEFT, LV_PART_MAIN);
+        ui::styles::apply_log_line(log_labels_[i]);
         lv_obj_align(log_labels_[i], LV_ALIGN_TOP_LEFT, 10, 60 + (i * 26));
     }
 
@@ -49,6 +48,9 @@ void GameLogsScreen::create_widgets() {
     ui::styles::apply_bottom_button_label(confirm_label_);
     lv_label_set_text(confirm_label_, "Close");
     lv_obj_align(confirm_label_, LV_ALIGN_CENTER, 0, -12);
+
+    // Register event callbacks once per widget tree (cached trees keep them)
+    lv_obj_add_event_cb(bottom_button_, push_button_clicked_cb, LV_EVENT_CLICKED, this);
 }
 
 void GameLogsScreen::destroy_widgets() {
@@ -77,9 +79,6 @@ void GameLogsScreen::on_enter() {
     scroll_offset_ = 0;
     load_records();
     update_display();
-
-    // Setup event callback
-    lv_obj_add_event_cb(bottom_button_, push_button_clicked_cb, LV_EVENT_CLICKED, this);
 }
 
 void GameLogsScreen::on_exit() {
@@ -129,27 +128,62 @@ void GameLogsScreen::handle_button_click() {
     ESP_LOGI(kLogTag, "Button clicked, returning to game screen");
 
     // A6 → F6 chirp (dismiss)
-    play_tone(1760.0f, 40);
-    M5.delay(30);
-    play_tone(1397.0f, 60);
-
-    // Return to game active screen
-    ScreenManager::instance().transition_to(&GameActiveScreen::instance());
+    static constexpr hardware::ToneSequencer::Note kTones[] = {
+        {1760.0f, 30, 0},  // A6
+        {1397.0f, 60, 0}   // F6
+    };
+    play_tones(kTones);
+
+    // Reveal the game screen underneath
+    ScreenManager::instance().pop();
 }
 
 void GameLogsScreen::load_records() {
-    storage::GameRecord temp_records[50];
-    int raw_count = storage::GameLog::instance().load_games(temp_records, 50);
-
-    // Filter out invalid records (game_number == 0) and compact array
-    record_count_ = 0;
-    for (int i = 0; i < raw_count; i++) {
-        if (temp_records[i].game_number > 0) {
-            records_[record_count_++] = temp_records[i];
+    // Queued saves (e.g. the game just paused) come from the writer's queue through
+    // the cursor, so opening never waits for flash
+    record_count_ = static_cast<int>(storage::GameLog::instance().record_count());
+    for (auto& cached : page_cache_) {
+        cached.page = -1;
+    }
+    ESP_LOGI(kLogTag, "%d game records available", record_count_);
+}
+
+const GameLogsScreen::PageRows& GameLogsScreen::page_rows(int page) {
+    cache_clock_++;
+    PageRows* slot = &page_cache_[0];
+    for (auto& cached : page_cache_) {
+        if (cached.page == page) {
+            cached.last_used = cache_clock_;
+            return cached;
+        }
+        if (cached.last_used < slot->last_used) {
+            slot = &cached;
         }
     }
 
-    ESP_LOGI(kLogTag, "Loaded %d valid game records (from %d total)", record_count_, raw_count);
+    // Miss: reuse the least recently shown page (never the one on screen)
+    slot->page = page;
+    slot->last_used = cache_clock_;
+    storage::GameLog::Cursor cursor(page * kVisibleGames);
+    for (int i = 0; i < kVisibleGames; i++) {
+        const storage::GameRecord* rec = cursor.next();
+        if (rec == nullptr) {
+            // Hide empty rows instead of showing zeros
+            slot->rows[i][0] = '\0';
+            continue;
+        }
+
+        // Time strings are M:SS or H:MM:SS (hours omitted if zero)
+        char game_time_str[16];
+        char paused_time_str[16];
+        GameState::format_duration(rec->game_seconds * GameState::kUsPerSecond, game_time_str,
+                                   sizeof(game_time_str));
+        GameState::format_duration(rec->paused_seconds * GameState::kUsPerSecond, paused_time_str,
+                                   sizeof(paused_time_str));
+        snprintf(slot->rows[i], kRowChars, "#%lu: %s / %s R%d", (unsigned long)rec->game_number,
+                 game_time_str, paused_time_str, (int)rec->max_round);
+    }
+    return *slot;
 }
 
 void GameLogsScreen::update_display() {
@@ -174,49 +208,9 @@ void GameLogsScreen::update_display() {
     lv_label_set_text(title_, title_text);
 
     // Display games in reverse order (most recent first)
+    const PageRows& rows = page_rows(current_page - 1);
     for (int i = 0; i < kVisibleGames; i++) {
-        int record_idx = record_count_ - 1 - (scroll_offset_ + i);
-
-        if (record_idx >= 0 && record_idx < record_count_) {
-            const auto& rec = records_[record_idx];
-
-            // Format time strings (M:SS or H:MM:SS - omit hours if zero)
-            int g_hours = rec.game_seconds / 3600;
-            int g_mins = (rec.game_seconds % 3600) / 60;
-            int g_secs = rec.game_seconds % 60;
-
-            int p_hours = rec.paused_seconds / 3600;
-            int p_mins = (rec.paused_seconds % 3600) / 60;
-            int p_secs = rec.paused_seconds % 60;
-
-            char game_time_str[16];
-            char paused_time_str[16];
-
-            if (g_hours > 0) {
-                snprintf(game_time_str, sizeof(game_time_str), "%d:%02d:%02d", g_hours, g_mins, g_secs);
-            } else {
-                snprintf(game_time_str, sizeof(game_time_str), "%d:%02d", g_mins, g_secs);
-            }
-
-            if (p_hours > 0) {
-                snprintf(paused_time_str, sizeof(paused_time_str), "%d:%02d:%02d", p_hours, p_mins, p_secs);
-            } else {
-                snprintf(paused_time_str, sizeof(paused_time_str), "%d:%02d", p_mins, p_secs);
-            }
-
-            char label_text[80];
-            snprintf(label_text, sizeof(label_text),
-                     "#%lu: %s / %s R%d",
-                     (unsigned long)rec.game_number,
-                     game_time_str,
-                     paused_time_str,
-                     (int)rec.max_round);
-
-            lv_label_set_text(log_labels_[i], label_text);
-        } else {
-            // Hide empty rows instead of showing zeros
-            lv_label_set_text(log_labels_[i], "");
-        }
+        lv_label_set_text_static(log_labels_[i], rows.rows[i]);
     }
 }
 
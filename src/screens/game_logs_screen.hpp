@@ -5,6 +5,9 @@
 
 /// Game logs viewer screen showing saved game records.
 /// Displays list of saved games with game time, paused time, and max round.
+/// Only the visible page is read from storage (through GameLog::Cursor), and the
+/// formatted rows of recently shown pages are cached, so opening the screen and
+/// scrolling cost the same however long the history grows.
 class GameLogsScreen : public Screen {
 public:
     /// Get the singleton instance.
@@ -28,17 +31,31 @@ private:
     lv_obj_t* bottom_button_ = nullptr;
     lv_obj_t* confirm_label_ = nullptr;
 
-    storage::GameRecord records_[50];
+    static constexpr int kVisibleGames = 5;
+
+    static constexpr int kRowChars = 48;
+    static constexpr int kCachedPages = 3;
+
+    /// Formatted rows of one page (labels point straight at them)
+    struct PageRows {
+        int page = -1;          // -1 = empty slot
+        uint32_t last_used = 0;
+        char rows[kVisibleGames][kRowChars];
+    };
+
+    PageRows page_cache_[kCachedPages];
+    uint32_t cache_clock_ = 0;
     int record_count_ = 0;
     int scroll_offset_ = 0;  // Index of first visible game
-
-    static constexpr int kVisibleGames = 5;
     static constexpr float kToneUp = 2637.0f;      // E7
     static constexpr float kToneDown = 1760.0f;    // A6
     static constexpr float kToneBoundary = 1245.0f; // D#6 (boundary)
     static constexpr uint32_t kToneDuration = 60;
 
     void load_records();
+
+    /// Rows for a page (0 = newest games), formatted on a cache miss
+    const PageRows& page_rows(int page);
     void update_display();
 
     // Touch handler
@@ -2,6 +2,7 @@
 
 #include <M5Unified.hpp>
 #include <esp_log.h>
+#include <esp_timer.h>
 #include "game_state.hpp"
 #include "screen_manager.hpp"
 #include "blind_progression_screen.hpp"
@@ -20,7 +21,7 @@ RoundMinutesScreen& RoundMinutesScreen::instance() {
 void RoundMinutesScreen::create_widgets() {
     ESP_LOGI(kLogTag, "Creating widgets");
 
-    lv_obj_t* scr = lv_scr_act();
+    lv_obj_t* scr = root();
 
     // Title background banner
     title_bg_ = lv_obj_create(scr);
@@ -58,7 +59,7 @@ void RoundMinutesScreen::create_widgets() {
     lv_obj_set_pos(info_button_, 185, 103);
     lv_obj_t* info_label = lv_label_create(info_button_);
     lv_label_set_text(info_label, "i");
-    lv_obj_set_style_text_color(info_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    ui::styles::apply_info_button_label(info_label);
     lv_obj_center(info_label);
 
     // Info overlay
@@ -77,27 +78,19 @@ void RoundMinutesScreen::create_widgets() {
     lv_label_set_text(info_title_, "Chip Breakdown");
 
     info_blue_ = lv_label_create(info_overlay_);
-    lv_label_set_text(info_blue_, "16 x Blue (25) = 400");
-    lv_obj_set_style_text_color(info_blue_, lv_color_hex(0x4488FF), LV_PART_MAIN);
-    lv_obj_set_style_text_align(info_blue_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::helpers::set_chip_line(info_blue_, 0);
     lv_obj_align(info_blue_, LV_ALIGN_CENTER, 0, -35);
 
     info_white_ = lv_label_create(info_overlay_);
-    lv_label_set_text(info_white_, "20 x White (50) = 1000");
-    lv_obj_set_style_text_color(info_white_, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
-    lv_obj_set_style_text_align(info_white_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::helpers::set_chip_line(info_white_, 1);
     lv_obj_align(info_white_, LV_ALIGN_CENTER, 0, -10);
 
     info_red_ = lv_label_create(info_overlay_);
-    lv_label_set_text(info_red_, "6 x Red (100) = 600");
-    lv_obj_set_style_text_color(info_red_, lv_color_hex(0xFF4444), LV_PART_MAIN);
-    lv_obj_set_style_text_align(info_red_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::helpers::set_chip_line(info_red_, 2);
     lv_obj_align(info_red_, LV_ALIGN_CENTER, 0, 15);
 
     info_stack_ = lv_label_create(info_overlay_);
-    lv_label_set_text(info_stack_, "Total stack: 2000");
-    lv_obj_set_style_text_color(info_stack_, lv_color_hex(0xCCCCCC), LV_PART_MAIN);
-    lv_obj_set_style_text_align(info_stack_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::helpers::set_stack_line(info_stack_);
     lv_obj_align(info_stack_, LV_ALIGN_CENTER, 0, 45);
 
     info_close_button_ = ui::helpers::create_button(info_overlay_);
@@ -112,6 +105,12 @@ void RoundMinutesScreen::create_widgets() {
     lv_obj_align(info_close_label_, LV_ALIGN_CENTER, 0, -12);
 
     lv_obj_add_flag(info_overlay_, LV_OBJ_FLAG_HIDDEN);
+
+    // Register event callbacks once per widget tree (cached trees keep them)
+    lv_obj_add_event_cb(info_button_, info_button_clicked_cb, LV_EVENT_CLICKED, this);
+    lv_obj_add_event_cb(info_overlay_, info_overlay_clicked_cb, LV_EVENT_CLICKED, this);
+    lv_obj_add_event_cb(info_close_button_, info_overlay_clicked_cb, LV_EVENT_CLICKED, this);
+    lv_obj_add_event_cb(bottom_button_, push_button_clicked_cb, LV_EVENT_CLICKED, this);
 }
 
 void RoundMinutesScreen::destroy_widgets() {
@@ -146,13 +145,8 @@ void RoundMinutesScreen::on_enter() {
 
     // Reset to default value
     value_ = 10;
+    accel_.reset();
     update_display();
-
-    // Setup event callbacks
-    lv_obj_add_event_cb(info_button_, info_button_clicked_cb, LV_EVENT_CLICKED, this);
-    lv_obj_add_event_cb(info_overlay_, info_overlay_clicked_cb, LV_EVENT_CLICKED, this);
-    lv_obj_add_event_cb(info_close_button_, info_overlay_clicked_cb, LV_EVENT_CLICKED, this);
-    lv_obj_add_event_cb(bottom_button_, push_button_clicked_cb, LV_EVENT_CLICKED, this);
 }
 
 void RoundMinutesScreen::on_exit() {
@@ -164,8 +158,8 @@ void RoundMinutesScreen::handle_encoder(int diff) {
         return;  // Ignore encoder when modal overlay is shown
     }
 
-    // Normalize to step delta
-    int step = (diff > 0) ? 1 : -1;
+    // Scale by rotation speed (slow turns stay one step per detent)
+    int step = accel_.apply(diff, esp_timer_get_time());
     int next = value_ + step * kStep;
     bool boundary = false;
 
@@ -204,9 +198,11 @@ void RoundMinutesScreen::handle_button_click() {
     GameState::instance().set_round_minutes(value_);
 
     // Play confirmation tone (F7 → F7 double beep - build excitement)
-    play_tone(2793.0f, 80);
-    M5.delay(60);
-    play_tone(2793.0f, 80);
+    static constexpr hardware::ToneSequencer::Note kTones[] = {
+        {2793.0f, 60, 0},
+        {2793.0f, 80, 0}
+    };
+    play_tones(kTones);
 
     // Transition to Blind Progression Screen
     ScreenManager::instance().transition_to(&BlindProgressionScreen::instance());
@@ -235,18 +231,22 @@ void RoundMinutesScreen::show_info() {
     ESP_LOGI(kLogTag, "Showing info overlay");
     set_visible(info_overlay_, true);
     // F#7 → A7 chirp (playful upward)
-    play_tone(2794.0f, 40);  // F#7
-    M5.delay(40);
-    play_tone(3520.0f, 60);  // A7
+    static constexpr hardware::ToneSequencer::Note kTones[] = {
+        {2794.0f, 40, 0},  // F#7
+        {3520.0f, 60, 0}   // A7
+    };
+    play_tones(kTones);
 }
 
 void RoundMinutesScreen::hide_info() {
     ESP_LOGI(kLogTag, "Hiding info overlay");
     set_visible(info_overlay_, false);
     // A6 → F6 chirp (playful downward)
-    play_tone(1760.0f, 40);  // A6
-    M5.delay(40);
-    play_tone(1397.0f, 60);  // F6
+    static constexpr hardware::ToneSequencer::Note kTones[] = {
+        {1760.0f, 40, 0},  // A6
+        {1397.0f, 60, 0}   // F6
+    };
+    play_tones(kTones);
 }
 
 bool RoundMinutesScreen::is_modal_blocking() const {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "screen.hpp"
+#include "input/encoder_accel.hpp"
 
 /// Configuration screen for setting minutes between rounds.
 /// Allows selection from 5-45 minutes in steps of 5 using rotary encoder.
@@ -49,6 +50,8 @@ private:
     static constexpr float kToneBoundary = 1245.0f;  // D#6 (lower = blocked)
     static constexpr uint32_t kToneDuration = 60;    // milliseconds (quick feedback)
 
+    encoder_input::EncoderAccel accel_;  // Fast spins move several steps per detent
+
     void update_display();
 
     // Touch handlers
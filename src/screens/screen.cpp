@@ -1,12 +1,38 @@
 #include "screen.hpp"
 
-#include <M5Unified.hpp>
 #include "ui/ui_root.hpp"
+#include "ui/ui_styles.hpp"
 
 const ui::Handles& Screen::ui() const {
     return ui::get();
 }
 
+void Screen::build_tree() {
+    if (root_) {
+        return;
+    }
+    // Transparent, unpadded and inert, so widgets lay out exactly as they did on the screen itself
+    root_ = lv_obj_create(lv_scr_act());
+    lv_obj_remove_style_all(root_);
+    ui::styles::apply_screen_root(root_);
+    lv_obj_clear_flag(root_, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_clear_flag(root_, LV_OBJ_FLAG_CLICKABLE);
+    create_widgets();
+}
+
+void Screen::destroy_tree() {
+    if (!root_) {
+        return;
+    }
+    destroy_widgets();
+    lv_obj_del(root_);
+    root_ = nullptr;
+}
+
+void Screen::set_tree_visible(bool visible) {
+    set_visible(root_, visible);
+}
+
 void Screen::set_visible(lv_obj_t* obj, bool visible) {
     if (!obj) {
         return;
@@ -20,6 +46,6 @@ void Screen::set_visible(lv_obj_t* obj, bool visible) {
 
 void Screen::play_tone(float freq_hz, uint32_t duration_ms) {
     if (freq_hz > 0.0f) {
-        M5.Speaker.tone(freq_hz, duration_ms);
+        hardware::ToneSequencer::instance().play_tone(freq_hz, duration_ms);
     }
 }
@@ -3,6 +3,7 @@
 #include <lvgl.h>
 #include <cstdint>
 #include "ui/ui_root.hpp"
+#include "hardware/tone_sequencer.hpp"
 
 /// Abstract base class for all application screens.
 /// Provides lifecycle hooks, input handling, and common utilities.
@@ -10,26 +11,29 @@ class Screen {
 public:
     virtual ~Screen() = default;
 
-    /// Create this screen's LVGL widgets.
-    /// Called before on_enter() during screen transition.
+    /// Create this screen's LVGL widgets under root().
+    /// Called once per widget tree, before the first on_enter() that uses it.
+    /// Event callbacks belong here so a cached tree registers them only once.
     virtual void create_widgets() = 0;
 
     /// Destroy this screen's LVGL widgets.
-    /// Called after on_exit() during screen transition.
+    /// Called after on_exit() when the widget tree is not cached.
     virtual void destroy_widgets() = 0;
 
     /// Called when this screen becomes active.
     /// Use this to setup UI widgets and initialize state.
     virtual void on_enter() = 0;
 
-    /// Called when this screen is deactivated.
+    /// Called when this screen is deactivated (replaced or popped).
     /// Use this to cleanup resources (optional - default is no-op).
     virtual void on_exit() {}
 
-    /// Called when this screen is temporarily backgrounded (future use).
+    /// Called when another screen is pushed over this one.
+    /// The widget tree is hidden but kept, along with all screen state.
     virtual void on_suspend() {}
 
-    /// Called when this screen returns from background (future use).
+    /// Called when the screen covering this one is popped.
+    /// The widget tree is shown exactly as it was left; on_enter() is not called.
     virtual void on_resume() {}
 
     /// Handle rotary encoder rotation.
@@ -39,23 +43,47 @@ public:
     /// Handle button A click (press + release).
     virtual void handle_button_click() = 0;
 
-    /// Called every frame from main loop (optional).
-    /// Use for animations, timers, or continuous updates.
+    /// Called once per elapsed second from the main loop's game tick (optional).
+    /// Use for countdowns and other per-second updates.
     /// Default implementation does nothing.
     virtual void tick() {}
 
+    /// Create the root container and build the widget tree into it.
+    void build_tree();
+
+    /// Destroy the widget tree and its root container.
+    void destroy_tree();
+
+    /// Show or hide the whole widget tree.
+    void set_tree_visible(bool visible);
+
+    /// True while the widget tree exists (shown or cached).
+    bool has_tree() const { return root_ != nullptr; }
+
 protected:
+    /// Full-screen container this screen's widgets are created in.
+    lv_obj_t* root() const { return root_; }
+
     /// Get access to shared LVGL UI widget handles.
     const ui::Handles& ui() const;
 
     /// Helper to show/hide LVGL objects.
     void set_visible(lv_obj_t* obj, bool visible);
 
-    /// Helper to play a tone through M5 speaker.
+    /// Helper to play a tone through M5 speaker (non-blocking).
     void play_tone(float freq_hz, uint32_t duration_ms);
 
+    /// Helper to play a note sequence in the background (non-blocking).
+    template <size_t N>
+    void play_tones(const hardware::ToneSequencer::Note (&notes)[N]) {
+        hardware::ToneSequencer::instance().play(notes);
+    }
+
     /// Check if a modal overlay is currently blocking input.
     /// Uses LVGL widget visibility as single source of truth.
     /// Default implementation returns false (no modals).
     virtual bool is_modal_blocking() const { return false; }
+
+private:
+    lv_obj_t* root_ = nullptr;
 };
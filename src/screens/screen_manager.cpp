@@ -1,9 +1,19 @@
 #include "screen_manager.hpp"
 
 #include <esp_log.h>
+#include <esp_timer.h>
+#include <lvgl.h>
+
+#include "hardware/config.hpp"
 
 namespace {
 constexpr const char* kLogTag = "screen_manager";
+
+int lvgl_heap_used() {
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    return static_cast<int>(mon.total_size - mon.free_size);
+}
 }
 
 ScreenManager& ScreenManager::instance() {
@@ -21,39 +31,138 @@ void ScreenManager::transition_to(Screen* next_screen) {
         return;
     }
 
-    if (current_ == next_screen) {
+    if (depth_ == 1 && current() == next_screen) {
         ESP_LOGW(kLogTag, "Already on target screen, ignoring transition");
         return;
     }
 
     ESP_LOGI(kLogTag, "Transitioning from %p to %p",
-             static_cast<void*>(current_),
+             static_cast<void*>(current()),
              static_cast<void*>(next_screen));
 
-    if (current_ != nullptr) {
-        current_->on_exit();
-        current_->destroy_widgets();
+    int64_t start_us = esp_timer_get_time();
+
+    // The visible screen and every screen it covered are left
+    while (depth_ > 0) {
+        leave(stack_[--depth_]);
+    }
+
+    stack_[depth_++] = next_screen;
+    bool built = show(next_screen);
+    next_screen->on_enter();
+
+    log_transition(built ? "built" : "cached", esp_timer_get_time() - start_us);
+}
+
+void ScreenManager::push(Screen* next_screen) {
+    if (next_screen == nullptr) {
+        ESP_LOGW(kLogTag, "Attempted to push null screen");
+        return;
+    }
+
+    for (int i = 0; i < depth_; i++) {
+        if (stack_[i] == next_screen) {
+            ESP_LOGW(kLogTag, "Screen %p already on the stack, ignoring push",
+                     static_cast<void*>(next_screen));
+            return;
+        }
+    }
+
+    if (depth_ == kMaxDepth) {
+        ESP_LOGE(kLogTag, "Screen stack full, ignoring push");
+        return;
+    }
+
+    ESP_LOGI(kLogTag, "Pushing %p over %p",
+             static_cast<void*>(next_screen),
+             static_cast<void*>(current()));
+
+    int64_t start_us = esp_timer_get_time();
+
+    // The covered screen keeps its widgets and state, only hidden
+    if (Screen* covered = current()) {
+        covered->on_suspend();
+        covered->set_tree_visible(false);
     }
 
-    current_ = next_screen;
-    current_->create_widgets();
-    current_->on_enter();
+    stack_[depth_++] = next_screen;
+    bool built = show(next_screen);
+    next_screen->on_enter();
+
+    log_transition(built ? "pushed, built" : "pushed, cached", esp_timer_get_time() - start_us);
+}
+
+void ScreenManager::pop() {
+    if (depth_ < 2) {
+        ESP_LOGW(kLogTag, "No covered screen to return to, ignoring pop");
+        return;
+    }
+
+    ESP_LOGI(kLogTag, "Popping %p, revealing %p",
+             static_cast<void*>(stack_[depth_ - 1]),
+             static_cast<void*>(stack_[depth_ - 2]));
+
+    int64_t start_us = esp_timer_get_time();
+
+    leave(stack_[--depth_]);
+
+    // Reveal exactly as it was left: no rebuild and no on_enter()
+    Screen* revealed = current();
+    revealed->set_tree_visible(true);
+    revealed->on_resume();
+
+    log_transition("revealed", esp_timer_get_time() - start_us);
+}
+
+void ScreenManager::leave(Screen* screen) {
+    screen->on_exit();
+    if (hardware::config::screens::CACHE_WIDGETS) {
+        screen->set_tree_visible(false);
+    } else {
+        screen->destroy_tree();
+    }
+}
+
+bool ScreenManager::show(Screen* screen) {
+    if (screen->has_tree()) {
+        screen->set_tree_visible(true);
+        return false;
+    }
+
+    int used_before = lvgl_heap_used();
+    screen->build_tree();
+    ESP_LOGI(kLogTag, "Widget tree built: %d B of LVGL heap", lvgl_heap_used() - used_before);
+    return true;
+}
+
+void ScreenManager::log_transition(const char* kind, int64_t elapsed_us) {
+    // Object tree work only; the redraw happens on the next lv_timer_handler() pass
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    ESP_LOGI(kLogTag, "Transition (%s) took %lld us; LVGL heap: %u B used (peak %u), "
+             "%u B free, largest block %u B, frag %u%%",
+             kind, static_cast<long long>(elapsed_us),
+             static_cast<unsigned>(mon.total_size - mon.free_size),
+             static_cast<unsigned>(mon.max_used),
+             static_cast<unsigned>(mon.free_size),
+             static_cast<unsigned>(mon.free_biggest_size),
+             static_cast<unsigned>(mon.frag_pct));
 }
 
 void ScreenManager::handle_encoder(int diff) {
-    if (current_ != nullptr) {
-        current_->handle_encoder(diff);
+    if (Screen* screen = current()) {
+        screen->handle_encoder(diff);
     }
 }
 
 void ScreenManager::handle_button_click() {
-    if (current_ != nullptr) {
-        current_->handle_button_click();
+    if (Screen* screen = current()) {
+        screen->handle_button_click();
     }
 }
 
 void ScreenManager::tick() {
-    if (current_ != nullptr) {
-        current_->tick();
+    if (Screen* screen = current()) {
+        screen->tick();
     }
 }
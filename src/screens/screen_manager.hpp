@@ -1,8 +1,11 @@
 #pragma once
 
+#include <cstdint>
 #include "screen.hpp"
 
-/// Manages the active screen and routes input events.
+/// Manages the screen stack and routes input events to the top screen.
+/// transition_to() replaces the whole stack; push()/pop() cover and reveal
+/// screens without tearing down the one underneath.
 /// Implements singleton pattern for global access.
 class ScreenManager {
 public:
@@ -12,13 +15,26 @@ public:
     /// Initialize the screen manager (call once at startup).
     void init();
 
-    /// Transition to a new screen.
-    /// Calls on_exit() on current screen, then on_enter() on next screen.
+    /// Transition to a new screen, replacing the whole stack.
+    /// Calls on_exit() on every stacked screen, then on_enter() on next screen.
+    /// In screen cache mode (config::screens::CACHE_WIDGETS) old widget trees are
+    /// hidden instead of destroyed, and the next screen's tree is only built on
+    /// its first visit.
     /// @param next_screen Pointer to the new screen (must remain valid)
     void transition_to(Screen* next_screen);
 
+    /// Cover the current screen with another one.
+    /// The covered screen gets on_suspend() and keeps its widgets and state;
+    /// next_screen gets on_enter().
+    /// @param next_screen Pointer to the new screen (must remain valid, not already stacked)
+    void push(Screen* next_screen);
+
+    /// Leave the current screen and reveal the one it covered.
+    /// The popped screen gets on_exit(); the revealed one only gets on_resume().
+    void pop();
+
     /// Get the currently active screen (may be nullptr).
-    Screen* current() const { return current_; }
+    Screen* current() const { return depth_ > 0 ? stack_[depth_ - 1] : nullptr; }
 
     /// Route encoder input to the active screen.
     void handle_encoder(int diff);
@@ -26,7 +42,7 @@ public:
     /// Route button click to the active screen.
     void handle_button_click();
 
-    /// Update active screen (called from main loop).
+    /// Update active screen (called from main loop once per game tick).
     void tick();
 
 private:
@@ -34,5 +50,19 @@ private:
     ScreenManager(const ScreenManager&) = delete;
     ScreenManager& operator=(const ScreenManager&) = delete;
 
-    Screen* current_ = nullptr;
+    /// Deepest push()/pop() nesting (the game screen plus one overlay screen today)
+    static constexpr int kMaxDepth = 4;
+
+    /// on_exit() a screen, then hide (cache mode) or destroy its widget tree
+    void leave(Screen* screen);
+
+    /// Build a screen's widget tree or show its cached one (before on_enter())
+    /// @return true if the tree was built
+    bool show(Screen* screen);
+
+    /// Log how long a transition took and the LVGL heap state after it
+    void log_transition(const char* kind, int64_t elapsed_us);
+
+    Screen* stack_[kMaxDepth] = {};
+    int depth_ = 0;
 };
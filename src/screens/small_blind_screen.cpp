@@ -3,6 +3,7 @@
 #include <M5Unified.hpp>
 #include <algorithm>
 #include <esp_log.h>
+#include <esp_timer.h>
 #include "game_state.hpp"
 #include "screen_manager.hpp"
 #include "round_minutes_screen.hpp"
@@ -21,8 +22,8 @@ SmallBlindScreen& SmallBlindScreen::instance() {
 void SmallBlindScreen::create_widgets() {
     ESP_LOGI(kLogTag, "Creating widgets");
 
-    // Get the default screen (root)
-    lv_obj_t* scr = lv_scr_act();
+    // Build into this screen's own container (kept across transitions in cache mode)
+    lv_obj_t* scr = root();
 
     // Title background banner (created first for z-order)
     title_bg_ = lv_obj_create(scr);
@@ -60,7 +61,7 @@ void SmallBlindScreen::create_widgets() {
     lv_obj_set_pos(info_button_, 185, 103);
     lv_obj_t* info_label = lv_label_create(info_button_);
     lv_label_set_text(info_label, "i");
-    lv_obj_set_style_text_color(info_label, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
+    ui::styles::apply_info_button_label(info_label);
     lv_obj_center(info_label);
 
     // Info overlay (full screen, initially hidden)
@@ -82,27 +83,19 @@ void SmallBlindScreen::create_widgets() {
 
     // Chip breakdown content
     info_blue_ = lv_label_create(info_overlay_);
-    lv_label_set_text(info_blue_, "16 x Blue (25) = 400");
-    lv_obj_set_style_text_color(info_blue_, lv_color_hex(0x4488FF), LV_PART_MAIN);
-    lv_obj_set_style_text_align(info_blue_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::helpers::set_chip_line(info_blue_, 0);
     lv_obj_align(info_blue_, LV_ALIGN_CENTER, 0, -35);
 
     info_white_ = lv_label_create(info_overlay_);
-    lv_label_set_text(info_white_, "20 x White (50) = 1000");
-    lv_obj_set_style_text_color(info_white_, lv_color_hex(0xFFFFFF), LV_PART_MAIN);
-    lv_obj_set_style_text_align(info_white_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::helpers::set_chip_line(info_white_, 1);
     lv_obj_align(info_white_, LV_ALIGN_CENTER, 0, -10);
 
     info_red_ = lv_label_create(info_overlay_);
-    lv_label_set_text(info_red_, "6 x Red (100) = 600");
-    lv_obj_set_style_text_color(info_red_, lv_color_hex(0xFF4444), LV_PART_MAIN);
-    lv_obj_set_style_text_align(info_red_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::helpers::set_chip_line(info_red_, 2);
     lv_obj_align(info_red_, LV_ALIGN_CENTER, 0, 15);
 
     info_stack_ = lv_label_create(info_overlay_);
-    lv_label_set_text(info_stack_, "Total stack: 2000");
-    lv_obj_set_style_text_color(info_stack_, lv_color_hex(0xCCCCCC), LV_PART_MAIN);
-    lv_obj_set_style_text_align(info_stack_, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+    ui::helpers::set_stack_line(info_stack_);
     lv_obj_align(info_stack_, LV_ALIGN_CENTER, 0, 45);
 
     // Info close button
@@ -119,6 +112,12 @@ void SmallBlindScreen::create_widgets() {
 
     // Hide info overlay initially
     lv_obj_add_flag(info_overlay_, LV_OBJ_FLAG_HIDDEN);
+
+    // Register event callbacks once per widget tree (cached trees keep them)
+    lv_obj_add_event_cb(info_button_, info_button_clicked_cb, LV_EVENT_CLICKED, this);
+    lv_obj_add_event_cb(info_overlay_, info_overlay_clicked_cb, LV_EVENT_CLICKED, this);
+    lv_obj_add_event_cb(info_close_button_, info_overlay_clicked_cb, LV_EVENT_CLICKED, this);
+    lv_obj_add_event_cb(bottom_button_, push_button_clicked_cb, LV_EVENT_CLICKED, this);
 }
 
 void SmallBlindScreen::destroy_widgets() {
@@ -155,13 +154,8 @@ void SmallBlindScreen::on_enter() {
 
     // Reset to minimum value
     value_ = kMin;
+    accel_.reset();
     update_display();
-
-    // Setup event callbacks
-    lv_obj_add_event_cb(info_button_, info_button_clicked_cb, LV_EVENT_CLICKED, this);
-    lv_obj_add_event_cb(info_overlay_, info_overlay_clicked_cb, LV_EVENT_CLICKED, this);
-    lv_obj_add_event_cb(info_close_button_, info_overlay_clicked_cb, LV_EVENT_CLICKED, this);
-    lv_obj_add_event_cb(bottom_button_, push_button_clicked_cb, LV_EVENT_CLICKED, this);
 }
 
 void SmallBlindScreen::on_exit() {
@@ -173,8 +167,8 @@ void SmallBlindScreen::handle_encoder(int diff) {
         return;  // Ignore encoder when modal overlay is shown
     }
 
-    // Normalize to step delta
-    int step = (diff > 0) ? 1 : -1;
+    // Scale by rotation speed (slow turns stay one step per detent)
+    int step = accel_.apply(diff, esp_timer_get_time());
     int next = value_ + step * kStep;
     bool boundary = false;
 
@@ -213,9 +207,11 @@ void SmallBlindScreen::handle_button_click() {
     GameState::instance().set_small_blind(value_);
 
     // Play confirmation tone (D7 → D7 double beep - start of progression)
-    play_tone(2349.0f, 80);
-    M5.delay(60);
-    play_tone(2349.0f, 80);
+    static constexpr hardware::ToneSequencer::Note kTones[] = {
+        {2349.0f, 60, 0},
+        {2349.0f, 80, 0}
+    };
+    play_tones(kTones);
 
     // Transition to RoundMinutesScreen
     ScreenManager::instance().transition_to(&RoundMinutesScreen::instance());
@@ -244,18 +240,22 @@ void SmallBlindScreen::show_info() {
     ESP_LOGI(kLogTag, "Showing info overlay");
     set_visible(info_overlay_, true);
     // F#7 → A7 chirp (playful upward)
-    play_tone(2794.0f, 40);  // F#7
-    M5.delay(40);
-    play_tone(3520.0f, 60);  // A7
+    static constexpr hardware::ToneSequencer::Note kTones[] = {
+        {2794.0f, 40, 0},  // F#7
+        {3520.0f, 60, 0}   // A7
+    };
+    play_tones(kTones);
 }
 
 void SmallBlindScreen::hide_info() {
     ESP_LOGI(kLogTag, "Hiding info overlay");
     set_visible(info_overlay_, false);
     // A6 → F6 chirp (playful downward)
-    play_tone(1760.0f, 40);  // A6
-    M5.delay(40);
-    play_tone(1397.0f, 60);  // F6
+    static constexpr hardware::ToneSequencer::Note kTones[] = {
+        {1760.0f, 40, 0},  // A6
+        {1397.0f, 60, 0}   // F6
+    };
+    play_tones(kTones);
 }
 
 bool SmallBlindScreen::is_modal_blocking() const {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "screen.hpp"
+#include "input/encoder_accel.hpp"
 
 /// Configuration screen for setting the starting small blind value.
 /// Allows selection from 25-200 in steps of 25 using rotary encoder.
@@ -49,6 +50,8 @@ private:
     static constexpr float kToneBoundary = 1245.0f;  // D#6 (lower = blocked)
     static constexpr uint32_t kToneDuration = 60;    // milliseconds (quick feedback)
 
+    encoder_input::EncoderAccel accel_;  // Fast spins move several steps per detent
+
     void update_display();
 
     // Touch handlers
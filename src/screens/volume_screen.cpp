@@ -2,9 +2,10 @@
 
 #include <M5Unified.hpp>
 #include <esp_log.h>
+#include <esp_timer.h>
 #include "screen_manager.hpp"
-#include "game_active_screen.hpp"
-#include "storage/nvs_storage.hpp"
+#include "storage/event_journal.hpp"
+#include "storage/storage_writer.hpp"
 #include "ui/ui_helpers.hpp"
 #include "ui/ui_styles.hpp"
 
@@ -20,7 +21,7 @@ VolumeScreen& VolumeScreen::instance() {
 void VolumeScreen::create_widgets() {
     ESP_LOGI(kLogTag, "Creating widgets");
 
-    lv_obj_t* scr = lv_scr_act();
+    lv_obj_t* scr = root();
 
     // Title background banner
     title_bg_ = lv_obj_create(scr);
@@ -47,6 +48,9 @@ void VolumeScreen::create_widgets() {
     ui::styles::apply_bottom_button_label(confirm_label_);
     lv_label_set_text(confirm_label_, "Confirm");
     lv_obj_align(confirm_label_, LV_ALIGN_CENTER, 0, -12);
+
+    // Register event callbacks once per widget tree (cached trees keep them)
+    lv_obj_add_event_cb(bottom_button_, push_button_clicked_cb, LV_EVENT_CLICKED, this);
 }
 
 void VolumeScreen::destroy_widgets() {
@@ -68,12 +72,10 @@ void VolumeScreen::on_enter() {
     ESP_LOGI(kLogTag, "Entering screen");
 
     // Load saved volume or use current value
-    value_ = storage::NVSStorage::instance().load_volume(5);
+    value_ = storage::StorageWriter::instance().load_volume(5);
+    accel_.reset();
     apply_volume();
     update_display();
-
-    // Setup event callback
-    lv_obj_add_event_cb(bottom_button_, push_button_clicked_cb, LV_EVENT_CLICKED, this);
 }
 
 void VolumeScreen::on_exit() {
@@ -85,8 +87,8 @@ void VolumeScreen::handle_encoder(int diff) {
         return;
     }
 
-    // Normalize to step delta
-    int step = (diff > 0) ? 1 : -1;
+    // Scale by rotation speed (slow turns stay one step per detent)
+    int step = accel_.apply(diff, esp_timer_get_time());
     int next = value_ + step * kStep;
     bool boundary = false;
 
@@ -117,17 +119,19 @@ void VolumeScreen::handle_button_click() {
     ESP_LOGI(kLogTag, "Button clicked, saving volume=%d", value_);
 
     // Save to NVS
-    storage::NVSStorage::instance().save_volume(value_);
+    storage::StorageWriter::instance().save_volume(value_);
+    storage::EventJournal::instance().record(storage::JournalEvent::Volume, value_);
 
     // Play confirmation tone (B6 → C7 → B6 wobble - playful volume saved)
-    play_tone(1976.0f, 60);  // B6
-    M5.delay(40);
-    play_tone(2093.0f, 60);  // C7
-    M5.delay(40);
-    play_tone(1976.0f, 70);  // B6
-
-    // Return to game active screen
-    ScreenManager::instance().transition_to(&GameActiveScreen::instance());
+    static constexpr hardware::ToneSequencer::Note kTones[] = {
+        {1976.0f, 40, 0},  // B6
+        {2093.0f, 40, 0},  // C7
+        {1976.0f, 70, 0}   // B6
+    };
+    play_tones(kTones);
+
+    // Reveal the game screen underneath
+    ScreenManager::instance().pop();
 }
 
 void VolumeScreen::update_display() {
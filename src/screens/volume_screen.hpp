@@ -1,6 +1,7 @@
 #pragma once
 
 #include "screen.hpp"
+#include "input/encoder_accel.hpp"
 
 /// Volume control screen - adjusts speaker volume from 0-10.
 /// Uses rotary encoder for adjustment and displays large number.
@@ -38,6 +39,8 @@ private:
     static constexpr float kToneBoundary = 1245.0f;  // D#6 (lower = blocked)
     static constexpr uint32_t kToneDuration = 60;    // milliseconds (quick feedback)
 
+    encoder_input::EncoderAccel accel_{encoder_input::kVolumeAccelCurve};
+
     void update_display();
     void apply_volume();  // Apply current volume to M5.Speaker
 
@@ -0,0 +1,77 @@
+// SPDX-License-Identifier: CC-BY-NC-4.0
+
+#include "event_journal.hpp"
+#include "game_history.hpp"
+#include "storage_writer.hpp"
+#include <esp_log.h>
+#include <unistd.h>
+
+static const char *TAG = "event_journal";
+
+namespace storage {
+
+EventJournal& EventJournal::instance() {
+    static EventJournal inst;
+    return inst;
+}
+
+void EventJournal::request_write() {
+    StorageWriter::instance().request_write();
+}
+
+bool EventJournal::open_file() {
+    if (file_ != nullptr && ftell(file_) < kMaxFileBytes) {
+        return true;
+    }
+    if (file_ != nullptr) {
+        fclose(file_);
+        file_ = nullptr;
+        remove(OLD_PATH);
+        rename(PATH, OLD_PATH);
+        // Event times carry on from the end of events.old
+        ESP_LOGI(TAG, "Journal rotated");
+    }
+    if (!GameHistory::instance().is_ready()) {
+        return false;
+    }
+    file_ = fopen(PATH, "ab");
+    if (file_ == nullptr) {
+        ESP_LOGE(TAG, "Cannot open %s", PATH);
+        return false;
+    }
+    return true;
+}
+
+int EventJournal::write_pending() {
+    if (queue_.empty()) {
+        return 0;
+    }
+
+    // One batch takes the whole queue
+    uint32_t* batch = batch_;
+    size_t count = 0;
+    while (count < kQueueSize && queue_.pop(batch[1 + count])) {
+        count++;
+    }
+
+    if (!open_file()) {
+        lost_ += count;
+        return 0;
+    }
+
+    uint8_t flags = boot_batch_ ? kBatchBoot : 0;
+    batch[0] = kBatchMagic | (static_cast<uint32_t>(count) << 16) | (static_cast<uint32_t>(flags) << 24);
+    size_t words = 1 + count;
+    bool ok = fwrite(batch, sizeof(uint32_t), words, file_) == words && fflush(file_) == 0 &&
+              fsync(fileno(file_)) == 0;
+    if (!ok) {
+        ESP_LOGE(TAG, "Writing %u events failed", (unsigned)count);
+        lost_ += count;
+        return 0;
+    }
+    boot_batch_ = false;
+    ESP_LOGD(TAG, "Wrote %u events", (unsigned)count);
+    return static_cast<int>(count);
+}
+
+} // namespace storage
@@ -0,0 +1,121 @@
+// SPDX-License-Identifier: CC-BY-NC-4.0
+// Per-round event journal with a fixed 4-byte binary encoding
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <esp_timer.h>
+#include "util/spsc_queue.hpp"
+
+namespace storage {
+
+/// Journal event types (stored in 4 bits)
+enum class JournalEvent : uint8_t {
+    NewGame = 1,     // arg: round minutes
+    RoundStart = 2,  // arg: round number
+    Pause = 3,       // arg: round number
+    Resume = 4,      // arg: round number (not recorded for a skip, which resumes implicitly)
+    Skip = 5,        // arg: round being skipped
+    Volume = 6,      // arg: new volume (0-10)
+    GameNumber = 7,  // Wide word (see below): GameRecord::game_number of the following events
+};
+
+/// Timeline of what happened during games (round starts, pauses, skips...).
+/// record() packs an event into one 32-bit word and pushes it to a lock-free
+/// queue: a timer read, a shift and a store, no locks or allocation. The
+/// StorageWriter task drains the queue in batches to events.dat on the
+/// history partition.
+///
+/// Event word: bits 0-3 type, bits 4-11 arg (saturated), bits 12-31 time since
+/// the previous event in ticks of 2^17 us (~131 ms, so up to ~38 h per step).
+/// GameNumber words have no time field: bits 4-31 hold the game number and the
+/// event happens at the time of the event before it. One follows every NewGame
+/// (the number the game's record is saved under) and starts the events of a game
+/// resumed after a reset, so every event can be matched to its GameRecord.
+/// The file is a series of batches, each a 4-byte header followed by its events:
+///
+///     uint16  kBatchMagic
+///     uint8   event count
+///     uint8   flags (kBatchBoot: first batch since boot, times restart from boot)
+class EventJournal {
+public:
+    /// Events held in RAM until written
+    static constexpr size_t kQueueSize = 128;
+
+    /// Queue depth that asks StorageWriter for an early write
+    static constexpr size_t kWriteThreshold = kQueueSize / 2;
+
+    static constexpr int kTickShift = 17;
+    static constexpr uint32_t kMaxTicks = (1u << 20) - 1;
+    static constexpr uint32_t kMaxGameNumber = (1u << 28) - 1;
+    static constexpr uint16_t kBatchMagic = 0x4A45;  // "EJ"
+    static constexpr uint8_t kBatchBoot = 0x01;
+    static_assert(kQueueSize <= 0xFF, "A batch count is one byte");
+
+    static EventJournal& instance();
+
+    /// Record an event (UI task only; safe on the hot path)
+    void record(JournalEvent type, int arg = 0) {
+        int64_t now = esp_timer_get_time();
+        uint64_t ticks = static_cast<uint64_t>(now - last_us_) >> kTickShift;
+        if (ticks > kMaxTicks) {
+            ticks = kMaxTicks;
+            last_us_ = now;
+        } else {
+            // Advance by whole ticks so rounding never accumulates
+            last_us_ += static_cast<int64_t>(ticks) << kTickShift;
+        }
+        uint32_t clamped = arg < 0 ? 0 : (arg > 0xFF ? 0xFF : arg);
+        uint32_t word = static_cast<uint32_t>(type) | (clamped << 4) | (static_cast<uint32_t>(ticks) << 12);
+        if (!queue_.push(word)) {
+            dropped_++;
+        } else if (queue_.size() == kWriteThreshold) {
+            request_write();
+        }
+    }
+
+    /// Record which game the following events belong to (UI task only)
+    void record_game_number(uint32_t game_number) {
+        uint32_t word = static_cast<uint32_t>(JournalEvent::GameNumber) | ((game_number & kMaxGameNumber) << 4);
+        if (!queue_.push(word)) {
+            dropped_++;
+        }
+    }
+
+    /// True if events are waiting to be written
+    bool has_pending() const { return !queue_.empty(); }
+
+    /// Append queued events to flash (StorageWriter task only)
+    /// @return Number of events written
+    int write_pending();
+
+    /// Events lost because the queue was full or storage was unavailable
+    uint32_t dropped() const { return dropped_ + lost_; }
+
+private:
+    EventJournal() = default;
+    EventJournal(const EventJournal&) = delete;
+    EventJournal& operator=(const EventJournal&) = delete;
+
+    /// Wake StorageWriter (kept out of line so record() stays small)
+    void request_write();
+
+    /// Start a new file once this one reaches kMaxFileBytes (the previous one is kept as .old)
+    bool open_file();
+
+    static constexpr long kMaxFileBytes = 32 * 1024;
+
+    util::SpscQueue<uint32_t, kQueueSize> queue_;
+    int64_t last_us_ = 0;      // Time of the previous event, in whole ticks since boot
+    uint32_t dropped_ = 0;     // Queue full (UI task)
+    uint32_t lost_ = 0;        // Write failed (StorageWriter task)
+    FILE* file_ = nullptr;
+    bool boot_batch_ = true;   // Next batch is the first since boot
+    uint32_t batch_[1 + kQueueSize];  // Header + events being written (kept off the writer's stack)
+
+    static constexpr const char* PATH = "/history/events.dat";
+    static constexpr const char* OLD_PATH = "/history/events.old";
+};
+
+} // namespace storage
@@ -0,0 +1,303 @@
+// SPDX-License-Identifier: CC-BY-NC-4.0
+
+#include "game_history.hpp"
+#include "record_codec.hpp"
+#include <esp_littlefs.h>
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <unistd.h>
+
+static const char *TAG = "game_history";
+
+namespace storage {
+
+namespace {
+// Decode the record at the current file position; adds its size to offset
+bool read_record(FILE* file, long& offset, uint32_t prev_number, GameRecord& record) {
+    uint8_t encoded[codec::kMaxEncodedSize];
+    int length = fgetc(file);
+    if (length <= 0 || static_cast<size_t>(length) >= sizeof(encoded)) {
+        return false;
+    }
+    encoded[0] = static_cast<uint8_t>(length);
+    if (fread(encoded + 1, 1, length, file) != static_cast<size_t>(length) ||
+        codec::decode(encoded, length + 1, prev_number, record) == 0) {
+        return false;
+    }
+    offset += length + 1;
+    return true;
+}
+}
+
+GameHistory& GameHistory::instance() {
+    static GameHistory inst;
+    return inst;
+}
+
+bool GameHistory::init() {
+    if (is_ready()) {
+        return true;
+    }
+
+    int64_t start = esp_timer_get_time();
+    esp_vfs_littlefs_conf_t conf = {};
+    conf.base_path = BASE_PATH;
+    conf.partition_label = PARTITION_LABEL;
+    conf.format_if_mount_failed = true;
+    esp_err_t err = esp_vfs_littlefs_register(&conf);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "LittleFS mount failed: %s", esp_err_to_name(err));
+        return false;
+    }
+
+    lock_ = xSemaphoreCreateMutex();
+    if (!open_data() || !open_index()) {
+        if (data_ != nullptr) {
+            fclose(data_);
+            data_ = nullptr;
+        }
+        return false;
+    }
+
+    size_t total = 0;
+    size_t used = 0;
+    esp_littlefs_info(PARTITION_LABEL, &total, &used);
+    ESP_LOGI(TAG, "History ready in %lu us: %lu records in %ld bytes, %u/%u KB used",
+             (unsigned long)(esp_timer_get_time() - start), (unsigned long)count_, end_offset_,
+             (unsigned)(used / 1024), (unsigned)(total / 1024));
+    return true;
+}
+
+bool GameHistory::open_data() {
+    data_ = fopen(DATA_PATH, "r+b");
+    if (data_ == nullptr) {
+        data_ = fopen(DATA_PATH, "w+b");
+        if (data_ == nullptr) {
+            ESP_LOGE(TAG, "Cannot create %s", DATA_PATH);
+            return false;
+        }
+        FileHeader header = {kMagic, codec::kVersion, 0};
+        fwrite(&header, sizeof(header), 1, data_);
+        fflush(data_);
+        remove(INDEX_PATH);
+        return true;
+    }
+
+    FileHeader header = {};
+    if (fread(&header, sizeof(header), 1, data_) != 1 || header.magic != kMagic) {
+        ESP_LOGE(TAG, "%s has an unknown format", DATA_PATH);
+        return false;
+    }
+    if (header.version == 1 && header.record_size == sizeof(codec::LegacyRecord)) {
+        return upgrade_v1();
+    }
+    if (header.version != codec::kVersion) {
+        ESP_LOGE(TAG, "%s is version %u, expected %u", DATA_PATH, header.version, codec::kVersion);
+        return false;
+    }
+    return true;
+}
+
+bool GameHistory::upgrade_v1() {
+    FILE* upgraded = fopen(UPGRADE_PATH, "wb");
+    if (upgraded == nullptr) {
+        ESP_LOGE(TAG, "Cannot create %s", UPGRADE_PATH);
+        return false;
+    }
+    FileHeader header = {kMagic, codec::kVersion, 0};
+    fwrite(&header, sizeof(header), 1, upgraded);
+
+    // Stream the fixed records across; the last one may be torn
+    fseek(data_, sizeof(FileHeader), SEEK_SET);
+    codec::LegacyRecord legacy;
+    uint32_t count = 0;
+    uint32_t previous_game = 0;
+    long before = sizeof(FileHeader);
+    long after = before;
+    while (fread(&legacy, sizeof(legacy), 1, data_) == 1) {
+        uint8_t encoded[codec::kMaxEncodedSize];
+        size_t size = codec::encode(codec::from_legacy(legacy), prev_number_for(count, previous_game), encoded);
+        fwrite(encoded, 1, size, upgraded);
+        previous_game = legacy.game_number;
+        before += sizeof(legacy);
+        after += size;
+        count++;
+    }
+    bool ok = fflush(upgraded) == 0 && fsync(fileno(upgraded)) == 0;
+    fclose(upgraded);
+    fclose(data_);
+    data_ = nullptr;
+
+    // The old file stays until the new one is complete
+    if (!ok || remove(DATA_PATH) != 0 || rename(UPGRADE_PATH, DATA_PATH) != 0) {
+        ESP_LOGE(TAG, "Upgrading %s failed", DATA_PATH);
+        return false;
+    }
+    remove(INDEX_PATH);
+    ESP_LOGI(TAG, "Upgraded %lu records: %ld -> %ld bytes", (unsigned long)count, before, after);
+
+    data_ = fopen(DATA_PATH, "r+b");
+    return data_ != nullptr;
+}
+
+bool GameHistory::open_index() {
+    index_ = fopen(INDEX_PATH, "r+b");
+    if (index_ == nullptr) {
+        index_ = fopen(INDEX_PATH, "w+b");
+        if (index_ == nullptr) {
+            ESP_LOGE(TAG, "Cannot create %s", INDEX_PATH);
+            return false;
+        }
+    }
+
+    fseek(data_, 0, SEEK_END);
+    long data_size = ftell(data_);
+    fseek(index_, 0, SEEK_END);
+    long index_size = ftell(index_);
+    uint32_t entries = index_size / sizeof(uint32_t);
+
+    // Start from the last page the index knows about, or rebuild it if it looks wrong
+    long offset = sizeof(FileHeader);
+    if (entries > 0) {
+        long last = page_offset(entries - 1);
+        if (index_size % sizeof(uint32_t) != 0 || last < offset || last >= data_size) {
+            ESP_LOGW(TAG, "Index damaged, rebuilding");
+            entries = 0;
+        } else {
+            offset = last;
+        }
+    }
+    count_ = entries > 0 ? (entries - 1) * kIndexStride : 0;
+
+    fseek(data_, offset, SEEK_SET);
+    for (;;) {
+        uint32_t prev_number = prev_number_for(count_, last_game_number_);
+        GameRecord record;
+        long at = offset;
+        if (!read_record(data_, offset, prev_number, record)) {
+            break;
+        }
+        if (count_ % kIndexStride == 0 && count_ / kIndexStride >= entries) {
+            uint32_t page = static_cast<uint32_t>(at);
+            fseek(index_, entries * sizeof(uint32_t), SEEK_SET);
+            fwrite(&page, sizeof(page), 1, index_);
+            entries++;
+        }
+        tail_offset_ = at;
+        tail_prev_number_ = prev_number;
+        last_game_number_ = record.game_number;
+        count_++;
+    }
+    end_offset_ = offset;
+
+    // Drop a record cut short by power loss and index pages past the end
+    fflush(data_);
+    if (end_offset_ < data_size) {
+        ESP_LOGW(TAG, "Dropping %ld bytes of partial record", data_size - end_offset_);
+        ftruncate(fileno(data_), end_offset_);
+    }
+    uint32_t needed = (count_ + kIndexStride - 1) / kIndexStride;
+    fflush(index_);
+    if (static_cast<long>(needed * sizeof(uint32_t)) < index_size) {
+        ftruncate(fileno(index_), needed * sizeof(uint32_t));
+    }
+    return true;
+}
+
+long GameHistory::page_offset(uint32_t page) {
+    uint32_t offset = 0;
+    fseek(index_, page * sizeof(uint32_t), SEEK_SET);
+    if (fread(&offset, sizeof(offset), 1, index_) != 1) {
+        return -1;
+    }
+    return offset;
+}
+
+bool GameHistory::put(const GameRecord& record) {
+    if (!is_ready()) {
+        return false;
+    }
+
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    bool rewrite = count_ > 0 && record.game_number == last_game_number_;
+    uint32_t index = rewrite ? count_ - 1 : count_;
+    uint32_t prev_number = rewrite ? tail_prev_number_ : prev_number_for(index, last_game_number_);
+    long offset = rewrite ? tail_offset_ : end_offset_;
+
+    uint8_t encoded[codec::kMaxEncodedSize];
+    size_t size = codec::encode(record, prev_number, encoded);
+    bool ok = fseek(data_, offset, SEEK_SET) == 0 && fwrite(encoded, 1, size, data_) == size;
+
+    // A shorter rewrite leaves stale bytes behind the record
+    long end = offset + static_cast<long>(size);
+    if (ok && end < end_offset_) {
+        ok = fflush(data_) == 0 && ftruncate(fileno(data_), end) == 0;
+    }
+
+    if (ok && !rewrite && index % kIndexStride == 0) {
+        // First record of an index page: note where the page starts
+        uint32_t page = static_cast<uint32_t>(offset);
+        ok = fseek(index_, (index / kIndexStride) * sizeof(uint32_t), SEEK_SET) == 0 &&
+             fwrite(&page, sizeof(page), 1, index_) == 1;
+    }
+    if (ok) {
+        tail_offset_ = offset;
+        tail_prev_number_ = prev_number;
+        end_offset_ = end;
+        if (!rewrite) {
+            count_++;
+            last_game_number_ = record.game_number;
+        }
+    }
+    xSemaphoreGive(lock_);
+
+    if (!ok) {
+        ESP_LOGE(TAG, "Writing game #%lu failed", (unsigned long)record.game_number);
+    }
+    return ok;
+}
+
+bool GameHistory::sync() {
+    if (!is_ready()) {
+        return false;
+    }
+
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    // Data before index: a short index is completed at boot, a dangling one is rebuilt
+    bool ok = fflush(data_) == 0 && fsync(fileno(data_)) == 0 &&
+              fflush(index_) == 0 && fsync(fileno(index_)) == 0;
+    xSemaphoreGive(lock_);
+
+    if (!ok) {
+        ESP_LOGE(TAG, "Sync failed");
+    }
+    return ok;
+}
+
+int GameHistory::read(uint32_t first, GameRecord* records, int max_count) {
+    if (!is_ready() || first >= count_ || max_count <= 0) {
+        return 0;
+    }
+
+    xSemaphoreTake(lock_, portMAX_DELAY);
+    uint32_t index = first - first % kIndexStride;
+    long offset = page_offset(index / kIndexStride);
+    uint32_t previous_game = 0;
+    int count = 0;
+    if (offset >= 0 && fseek(data_, offset, SEEK_SET) == 0) {
+        // Decode forward from the page start, keeping only the requested records
+        GameRecord record;
+        while (index < count_ && count < max_count &&
+               read_record(data_, offset, prev_number_for(index, previous_game), record)) {
+            previous_game = record.game_number;
+            if (index >= first) {
+                records[count++] = record;
+            }
+            index++;
+        }
+    }
+    xSemaphoreGive(lock_);
+    return count;
+}
+
+} // namespace storage
@@ -0,0 +1,107 @@
+// SPDX-License-Identifier: CC-BY-NC-4.0
+// Long-term game history in an append-only LittleFS file
+
+#pragma once
+
+#include <cstdint>
+#include <cstdio>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include "game_log.hpp"
+
+namespace storage {
+
+/// Every game ever played, on the "history" LittleFS partition.
+/// games.dat is a header followed by codec-encoded records in play order (see
+/// record_codec.hpp); records are only appended, except that the newest one is
+/// rewritten while its game is still in progress. Each record's game number is
+/// stored as a delta from the previous one, except at the start of an index page.
+/// games.idx holds the file offset of every kIndexStride-th record, so reading
+/// record N seeks straight to its index page and decodes forward from there:
+/// paging costs the same with ten games or ten thousand.
+/// Writes come from the StorageWriter task and reads from the UI task; a mutex
+/// serializes them.
+class GameHistory {
+public:
+    /// Records per index entry
+    static constexpr uint32_t kIndexStride = 16;
+
+    static GameHistory& instance();
+
+    /// Mount the partition (formatting it if it is blank or corrupt) and open the files.
+    /// Recovers from a write cut short by power loss and upgrades older file versions.
+    /// @return true if the history is usable
+    bool init();
+
+    /// True once init() has succeeded
+    bool is_ready() const { return data_ != nullptr; }
+
+    /// Number of records stored
+    uint32_t count() const { return count_; }
+
+    /// Game number of the newest record (0 if empty)
+    uint32_t newest_game_number() const { return count_ > 0 ? last_game_number_ : 0; }
+
+    /// Store a record: rewrites the newest record if it is the same game, else appends
+    bool put(const GameRecord& record);
+
+    /// Flush written records to flash
+    bool sync();
+
+    /// Read consecutive records, oldest first
+    /// @param first Index of the first record (0 = oldest)
+    /// @param records Output array
+    /// @param max_count Maximum number of records to read
+    /// @return Number of records read
+    int read(uint32_t first, GameRecord* records, int max_count);
+
+private:
+    GameHistory() = default;
+    ~GameHistory() = default;
+    GameHistory(const GameHistory&) = delete;
+    GameHistory& operator=(const GameHistory&) = delete;
+
+    /// games.dat header
+    struct FileHeader {
+        uint32_t magic;
+        uint16_t version;
+        uint16_t record_size;  // Fixed record size (version 1), 0 = variable
+    };
+
+    static constexpr uint32_t kMagic = 0x54534847;  // "GHST"
+
+    /// Open games.dat, creating or upgrading it as needed
+    bool open_data();
+
+    /// Rewrite a version 1 (fixed 20-byte records) file in the current format
+    bool upgrade_v1();
+
+    /// Open games.idx and walk the records after its last entry to find the
+    /// record count, adding missing entries and dropping a torn final record
+    bool open_index();
+
+    /// File offset of the first record of an index page (-1 on error)
+    long page_offset(uint32_t page);
+
+    /// Game number a record is delta-encoded against
+    uint32_t prev_number_for(uint32_t index, uint32_t previous_game) const {
+        return index % kIndexStride == 0 ? 0 : previous_game;
+    }
+
+    FILE* data_ = nullptr;
+    FILE* index_ = nullptr;
+    uint32_t count_ = 0;
+    uint32_t last_game_number_ = 0;  // Game number of the newest record
+    uint32_t tail_prev_number_ = 0;  // prev_number the newest record was encoded with
+    long tail_offset_ = 0;           // File offset of the newest record
+    long end_offset_ = 0;            // File offset after the newest record
+    SemaphoreHandle_t lock_ = nullptr;
+
+    static constexpr const char* PARTITION_LABEL = "history";
+    static constexpr const char* BASE_PATH = "/history";
+    static constexpr const char* DATA_PATH = "/history/games.dat";
+    static constexpr const char* INDEX_PATH = "/history/games.idx";
+    static constexpr const char* UPGRADE_PATH = "/history/games.tmp";
+};
+
+} // namespace storage
@@ -2,154 +2,328 @@
 
 #include "game_log.hpp"
 #include "game_state.hpp"
-#include <nvs_flash.h>
-#include <nvs.h>
+#include "event_journal.hpp"
+#include "game_history.hpp"
+#include "nvs_storage.hpp"
+#include "record_codec.hpp"
+#include "storage_writer.hpp"
+#include <esp_attr.h>
 #include <esp_log.h>
-#include <cstring>
+#include <esp_system.h>
+#include <cstdio>
 
 static const char *TAG = "game_log";
 
 namespace storage {
 
+namespace {
+// Game in progress, kept across a reset so a resumed game keeps its log slot
+struct CurrentGame {
+    uint32_t number;
+    uint32_t check;  // ~number when valid
+};
+RTC_NOINIT_ATTR CurrentGame s_rtc_current_game;
+
+void remember_current_game(uint32_t number) {
+    s_rtc_current_game.number = number;
+    s_rtc_current_game.check = ~number;
+}
+}
+
 GameLog& GameLog::instance() {
     static GameLog inst;
     return inst;
 }
 
-bool GameLog::save_current_game() {
-    // Initialize NVS
-    esp_err_t err = nvs_flash_init();
-    if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
-        ESP_ERROR_CHECK(nvs_flash_erase());
-        err = nvs_flash_init();
-    }
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "NVS init failed: %s", esp_err_to_name(err));
-        return false;
+void GameLog::init() {
+    auto& nvs = NVSStorage::instance();
+    game_count_ = 0;
+    nvs.get_u32(KEY_GAME_COUNT, game_count_);
+    if (!GameHistory::instance().init()) {
+        ESP_LOGW(TAG, "History unavailable, keeping the last %d games in NVS", kCapacity);
     }
+    migrate();
 
-    nvs_handle_t handle;
-    err = nvs_open(NAMESPACE, NVS_READWRITE, &handle);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "NVS open failed: %s", esp_err_to_name(err));
-        return false;
+    // Keep appending to the same record if GameState resumes the game after a reset
+    esp_reset_reason_t reason = esp_reset_reason();
+    const CurrentGame& rtc = s_rtc_current_game;
+    if (reason != ESP_RST_POWERON && reason != ESP_RST_UNKNOWN && rtc.check == ~rtc.number &&
+        rtc.number != 0 && rtc.number <= game_count_) {
+        current_game_ = rtc.number;
+    } else {
+        remember_current_game(0);
+    }
+    ESP_LOGI(TAG, "Game log ready: %lu games played", (unsigned long)game_count_);
+}
+
+void GameLog::begin_game() {
+    current_game_ = 0;
+    remember_current_game(0);
+    // A game never saved leaves its number to the next one
+    EventJournal::instance().record_game_number(game_number());
+}
+
+void GameLog::slot_key(char prefix, uint32_t game_number, char* key, size_t len) {
+    snprintf(key, len, "%c%02u", prefix, (unsigned)((game_number - 1) % kCapacity));
+}
+
+bool GameLog::store_record(const GameRecord& record) {
+    auto& history = GameHistory::instance();
+    if (history.is_ready()) {
+        return history.put(record);
+    }
+    uint8_t encoded[codec::kMaxEncodedSize];
+    size_t size = codec::encode(record, 0, encoded);
+    char key[8];
+    slot_key(kSlotPrefix, record.game_number, key, sizeof(key));
+    return NVSStorage::instance().set_blob(key, encoded, size);
+}
+
+bool GameLog::read_slot(uint32_t game_number, GameRecord& record) {
+    char key[8];
+    slot_key(kSlotPrefix, game_number, key, sizeof(key));
+    uint8_t encoded[codec::kMaxEncodedSize];
+    size_t size = sizeof(encoded);
+    // A slot whose number does not match was never written for this game
+    return NVSStorage::instance().get_blob(key, encoded, size) &&
+           codec::decode(encoded, size, 0, record) == size && record.game_number == game_number;
+}
+
+void GameLog::migrate() {
+    auto& nvs = NVSStorage::instance();
+    auto& history = GameHistory::instance();
+    uint32_t oldest = game_count_ > static_cast<uint32_t>(kCapacity) ? game_count_ - kCapacity + 1 : 1;
+    int moved = 0;
+    char key[8];
+
+    // Single-blob log (oldest format). Static: 1 KB is too much for the small boot task stack,
+    // and migrate() only runs once, from init()
+    static codec::LegacyRecord legacy[kCapacity];
+    size_t blob_size = sizeof(legacy);
+    bool have_blob = nvs.get_blob(KEY_LEGACY_BLOB, legacy, blob_size);
+    for (size_t i = 0; have_blob && i < blob_size / sizeof(codec::LegacyRecord); i++) {
+        if (legacy[i].game_number != 0 && store_record(codec::from_legacy(legacy[i]))) {
+            moved++;
+        }
+    }
+
+    // Fixed-size records in the "g" ring slots
+    bool slot_used[kCapacity] = {};
+    for (uint32_t number = oldest; number <= game_count_; number++) {
+        slot_key(kLegacySlotPrefix, number, key, sizeof(key));
+        size_t size = sizeof(codec::LegacyRecord);
+        if (nvs.get_blob(key, &legacy[0], size) && size == sizeof(codec::LegacyRecord) &&
+            legacy[0].game_number == number) {
+            slot_used[(number - 1) % kCapacity] = true;
+            if (store_record(codec::from_legacy(legacy[0]))) {
+                moved++;
+            }
+        }
+    }
+
+    // Encoded NVS fallback slots, once the history is available again
+    bool fallback_used[kCapacity] = {};
+    for (uint32_t number = oldest; history.is_ready() && number <= game_count_; number++) {
+        GameRecord record;
+        if (read_slot(number, record)) {
+            fallback_used[(number - 1) % kCapacity] = true;
+            if (history.put(record)) {
+                moved++;
+            }
+        }
+    }
+
+    if (!have_blob && moved == 0) {
+        return;  // Nothing to migrate
     }
+    if (history.is_ready() && !history.sync()) {
+        return;  // Keep the old copies; the move is retried next boot
+    }
+    if (have_blob) {
+        nvs.erase_key(KEY_LEGACY_BLOB);
+    }
+    for (int slot = 0; slot < kCapacity; slot++) {
+        if (slot_used[slot]) {
+            slot_key(kLegacySlotPrefix, slot + 1, key, sizeof(key));
+            nvs.erase_key(key);
+        }
+        if (fallback_used[slot]) {
+            slot_key(kSlotPrefix, slot + 1, key, sizeof(key));
+            nvs.erase_key(key);
+        }
+    }
+    nvs.commit();
+    ESP_LOGI(TAG, "Migrated %d records to the %s", moved, history.is_ready() ? "history" : "NVS slots");
+}
 
-    // Load existing game count
-    uint32_t game_count = 0;
-    nvs_get_u32(handle, KEY_GAME_COUNT, &game_count);
+bool GameLog::save_current_game() {
+    auto& nvs = NVSStorage::instance();
+    if (!nvs.is_ready()) {
+        ESP_LOGE(TAG, "Storage not ready, game not saved");
+        return false;
+    }
 
-    // Load existing records
-    GameRecord records[MAX_GAMES];
-    memset(records, 0, sizeof(records));
-    size_t blob_size = sizeof(records);
-    nvs_get_blob(handle, KEY_GAME_BLOB, records, &blob_size);
-    int existing_count = blob_size / sizeof(GameRecord);
+    // First save of this game takes the next slot and advances the head
+    bool new_game = current_game_ == 0;
+    uint32_t game_number = new_game ? game_count_ + 1 : current_game_;
 
-    // Create new record from current game state
+    // Create record from current game state
     auto& game = GameState::instance();
-    GameRecord new_record;
-    new_record.game_number = game_count + 1;
-    new_record.game_seconds = game.total_game_seconds();
-    new_record.paused_seconds = game.total_paused_seconds();
-    new_record.max_round = static_cast<uint16_t>(game.max_round_reached());
-    new_record.starting_small_blind = static_cast<uint8_t>(game.small_blind());
-    new_record.round_minutes = static_cast<uint8_t>(game.round_minutes());
+    GameRecord record;
+    record.game_number = game_number;
+    record.game_seconds = game.total_game_seconds();
+    record.paused_seconds = game.total_paused_seconds();
+    record.max_round = static_cast<uint16_t>(game.max_round_reached());
+    record.starting_small_blind = static_cast<uint16_t>(game.starting_small_blind());
+    record.round_minutes = static_cast<uint8_t>(game.round_minutes());
 
     // Determine blind mode from multiplier
     float multiplier = game.blind_multiplier();
     if (multiplier >= 1.9f && multiplier <= 2.1f) {
-        new_record.blind_mode = 1;  // TURBO
+        record.blind_mode = 1;  // TURBO
     } else if (multiplier >= 1.2f && multiplier <= 1.3f) {
-        new_record.blind_mode = 2;  // RELAXED
+        record.blind_mode = 2;  // RELAXED
     } else {
-        new_record.blind_mode = 0;  // STANDARD
+        record.blind_mode = 0;  // STANDARD
     }
-    new_record.reserved = 0;
 
-    // Ring buffer: shift if at capacity
-    if (existing_count >= MAX_GAMES) {
-        memmove(&records[0], &records[1], (MAX_GAMES - 1) * sizeof(GameRecord));
-        records[MAX_GAMES - 1] = new_record;
-    } else {
-        records[existing_count] = new_record;
-        existing_count++;
+    // The slot is allocated here so the UI sees the new game at once; the write is deferred
+    if (new_game) {
+        game_count_ = game_number;
+        current_game_ = game_number;
+        remember_current_game(game_number);
     }
+    StorageWriter::instance().save_game(record, new_game);
 
-    // Save back to NVS
-    nvs_set_u32(handle, KEY_GAME_COUNT, game_count + 1);
-    nvs_set_blob(handle, KEY_GAME_BLOB, records, existing_count * sizeof(GameRecord));
-    err = nvs_commit(handle);
-    nvs_close(handle);
+    ESP_LOGI(TAG, "Queued game #%lu: %lus game, %lus paused, round %d",
+             (unsigned long)record.game_number, (unsigned long)record.game_seconds,
+             (unsigned long)record.paused_seconds, (int)record.max_round);
+    return true;
+}
 
-    if (err == ESP_OK) {
-        ESP_LOGI(TAG, "Saved game #%lu: %lus game, %lus paused, round %d",
-                 (unsigned long)new_record.game_number, (unsigned long)new_record.game_seconds,
-                 (unsigned long)new_record.paused_seconds, (int)new_record.max_round);
-        return true;
-    } else {
-        ESP_LOGE(TAG, "NVS commit failed: %s", esp_err_to_name(err));
-        return false;
+bool GameLog::stage_record(const GameRecord& record, bool new_game) {
+    // Only this game's record (and the head on a new game) is written
+    auto& nvs = NVSStorage::instance();
+    bool ok = store_record(record);
+    if (ok && new_game) {
+        ok = nvs.set_u32(KEY_GAME_COUNT, record.game_number);
+    }
+    return ok;
+}
+
+void GameLog::sync() {
+    auto& history = GameHistory::instance();
+    if (history.is_ready()) {
+        history.sync();
     }
 }
 
 int GameLog::load_games(GameRecord* records, int max_count) {
-    // Initialize NVS
-    esp_err_t err = nvs_flash_init();
-    if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
-        ESP_ERROR_CHECK(nvs_flash_erase());
-        err = nvs_flash_init();
+    auto& writer = StorageWriter::instance();
+    auto& history = GameHistory::instance();
+
+    int count = 0;
+    if (history.is_ready()) {
+        // Newest max_count records, oldest first, with queued saves applied
+        uint32_t stored = history.count();
+        uint32_t first = stored > static_cast<uint32_t>(max_count) ? stored - max_count : 0;
+        count = history.read(first, records, max_count);
+        for (int i = 0; i < count; i++) {
+            writer.pending_game(records[i].game_number, records[i]);
+        }
+    } else {
+        // Newest kCapacity (or max_count) games, oldest first
+        uint32_t available = game_count_ < static_cast<uint32_t>(kCapacity) ? game_count_ : kCapacity;
+        if (available > static_cast<uint32_t>(max_count)) {
+            available = max_count;
+        }
+        for (uint32_t number = game_count_ - available + 1; number <= game_count_; number++) {
+            if (writer.pending_game(number, records[count]) || read_slot(number, records[count])) {
+                count++;
+            }
+        }
     }
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "NVS init failed: %s", esp_err_to_name(err));
-        return 0;
+
+    ESP_LOGI(TAG, "Loaded %d game records", count);
+    return count;
+}
+
+uint32_t GameLog::record_count() const {
+    auto& history = GameHistory::instance();
+    if (history.is_ready()) {
+        GameRecord queued;
+        return history.count() + (queued_new_game(queued) ? 1 : 0);
     }
+    return game_count_ < static_cast<uint32_t>(kCapacity) ? game_count_ : kCapacity;
+}
 
-    nvs_handle_t handle;
-    err = nvs_open(NAMESPACE, NVS_READONLY, &handle);
-    if (err != ESP_OK) {
-        ESP_LOGI(TAG, "NVS open failed (no games saved yet): %s", esp_err_to_name(err));
-        return 0;
+bool GameLog::queued_new_game(GameRecord& record) const {
+    // The NVS fallback counts games by number, so only the history needs this
+    auto& history = GameHistory::instance();
+    if (!history.is_ready() || game_count_ == 0 || history.newest_game_number() == game_count_) {
+        return false;
     }
+    return StorageWriter::instance().pending_game(game_count_, record);
+}
 
-    // Load records blob
-    size_t blob_size = max_count * sizeof(GameRecord);
-    err = nvs_get_blob(handle, KEY_GAME_BLOB, records, &blob_size);
-    nvs_close(handle);
+static_assert(GameLog::Cursor::kChunk == static_cast<int>(GameHistory::kIndexStride),
+              "Cursor chunks must line up with history index pages");
 
-    if (err == ESP_OK) {
-        int count = blob_size / sizeof(GameRecord);
-        ESP_LOGI(TAG, "Loaded %d game records", count);
-        return count;
+GameLog::Cursor::Cursor(uint32_t skip) {
+    auto& log = GameLog::instance();
+    auto& history = GameHistory::instance();
+    if (history.is_ready()) {
+        if (log.queued_new_game(queued_)) {
+            // Not in the history yet: it is the newest row
+            if (skip == 0) {
+                show_queued_ = true;
+            } else {
+                skip--;
+            }
+        }
+        next_ = skip < history.count() ? history.count() - skip : 0;
     } else {
-        ESP_LOGI(TAG, "NVS get blob failed: %s", esp_err_to_name(err));
-        return 0;
+        // NVS fallback: walk the ring backwards by game number (missing slots are skipped)
+        oldest_ = log.game_count_ > static_cast<uint32_t>(kCapacity) ? log.game_count_ - kCapacity + 1 : 1;
+        next_ = skip < log.game_count_ ? log.game_count_ - skip : 0;
     }
 }
 
-uint32_t GameLog::get_total_game_count() {
-    // Initialize NVS
-    esp_err_t err = nvs_flash_init();
-    if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
-        ESP_ERROR_CHECK(nvs_flash_erase());
-        err = nvs_flash_init();
+const GameRecord* GameLog::Cursor::next() {
+    if (show_queued_) {
+        show_queued_ = false;
+        return &queued_;
     }
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "NVS init failed: %s", esp_err_to_name(err));
-        return 0;
+    if (pos_ > 0) {
+        return &chunk_[--pos_];
     }
 
-    nvs_handle_t handle;
-    err = nvs_open(NAMESPACE, NVS_READONLY, &handle);
-    if (err != ESP_OK) {
-        return 0;
+    auto& writer = StorageWriter::instance();
+    auto& history = GameHistory::instance();
+    if (history.is_ready()) {
+        // Rest of one index page: a single seek and decode, newest handed out first
+        if (next_ == 0) {
+            return nullptr;
+        }
+        uint32_t first = (next_ - 1) - (next_ - 1) % kChunk;
+        pos_ = history.read(first, chunk_, next_ - first);
+        next_ = first;
+        for (int i = 0; i < pos_; i++) {
+            writer.pending_game(chunk_[i].game_number, chunk_[i]);
+        }
+    } else {
+        while (pos_ == 0 && next_ >= oldest_ && next_ > 0) {
+            if (writer.pending_game(next_, chunk_[0]) || GameLog::instance().read_slot(next_, chunk_[0])) {
+                pos_ = 1;
+            }
+            next_--;
+        }
     }
+    return pos_ > 0 ? &chunk_[--pos_] : nullptr;
+}
 
-    uint32_t game_count = 0;
-    nvs_get_u32(handle, KEY_GAME_COUNT, &game_count);
-    nvs_close(handle);
-
-    return game_count;
+uint32_t GameLog::get_total_game_count() {
+    return game_count_;
 }
 
 } // namespace storage
@@ -3,37 +3,91 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
 
 namespace storage {
 
-/// Single game record (20 bytes per entry)
+/// Single game record (in memory; stored with codec::encode(), see record_codec.hpp)
 struct GameRecord {
-    uint32_t game_number;         // Sequential game ID
-    uint32_t game_seconds;        // In-game time
-    uint32_t paused_seconds;      // Paused time
-    uint16_t max_round;           // Highest round reached
-    uint8_t starting_small_blind; // Starting SB value
-    uint8_t round_minutes;        // Round duration
-    uint8_t blind_mode;           // 0=STANDARD, 1=TURBO, 2=RELAXED
-    uint8_t reserved;             // Padding for alignment
+    uint32_t game_number;          // Sequential game ID
+    uint32_t game_seconds;         // In-game time
+    uint32_t paused_seconds;       // Paused time
+    uint16_t max_round;            // Highest round reached
+    uint16_t starting_small_blind; // Starting SB value
+    uint8_t round_minutes;         // Round duration
+    uint8_t blind_mode;            // 0=STANDARD, 1=TURBO, 2=RELAXED
 };
 
-/// Game log persistence manager using NVS ring buffer
+/// Game log persistence manager.
+/// Records go to GameHistory (LittleFS, every game ever played). If the history
+/// partition cannot be mounted, the log falls back to a ring buffer of NVS keys:
+/// each game owns one fixed slot key ("h00".."h49", slot = (game_number - 1) % kCapacity).
+/// Either way the lifetime game count in NVS is the head index, and saving writes
+/// only the current game's encoded record (plus the count when a new game starts).
+/// Saves are handed to StorageWriter; the flash write happens on its task.
 class GameLog {
 public:
+    /// Number of games kept by the NVS fallback (oldest are overwritten)
+    static constexpr int kCapacity = 50;
+
     static GameLog& instance();
 
-    /// Save current game session to NVS
-    /// @return true if saved successfully
+    /// Read the head index, open the history and migrate older logs into it
+    /// (call once after NVSStorage::init())
+    void init();
+
+    /// Start a new game: the next save takes a fresh slot
+    void begin_game();
+
+    /// Game number of the game in progress (the one its next save uses)
+    uint32_t game_number() const { return current_game_ != 0 ? current_game_ : game_count_ + 1; }
+
+    /// Queue the current game session for saving (rewrites this game's slot after the first save)
+    /// @return true if queued
     bool save_current_game();
 
-    /// Load all game records from NVS
+    /// Write one record into its slot without committing (StorageWriter task only)
+    /// @param new_game True if the head index advances to this record
+    bool stage_record(const GameRecord& record, bool new_game);
+
+    /// Flush staged records to flash (StorageWriter task only, after NVS commit)
+    void sync();
+
+    /// Load game records from NVS, oldest first (including saves not yet written)
     /// @param records Output array to fill
-    /// @param max_count Maximum number of records to load
+    /// @param max_count Maximum number of records to load (the newest are kept)
     /// @return Number of records actually loaded
     int load_games(GameRecord* records, int max_count);
 
+    /// Number of records that can be read back (including a queued first save)
+    uint32_t record_count() const;
+
+    /// Walks saved games newest first, reading one history index page at a time,
+    /// so memory and time per record stay constant however long the history is.
+    /// Records are decoded into the cursor; nothing is copied out.
+    /// Saves still queued on StorageWriter replace their stored copy, and a game
+    /// whose first save has not been written yet comes first, so callers never
+    /// need to wait for the writer.
+    class Cursor {
+    public:
+        static constexpr int kChunk = 16;  // Records per read (one history index page)
+
+        /// Start at the skip-th newest record
+        explicit Cursor(uint32_t skip = 0);
+
+        /// Next (older) record, or nullptr at the end. Valid until the next call.
+        const GameRecord* next();
+
+    private:
+        GameRecord chunk_[kChunk];
+        GameRecord queued_;    // Queued first save of the game in progress
+        bool show_queued_ = false;
+        int pos_ = 0;          // Records of chunk_ not handed out yet (taken from the back)
+        uint32_t next_ = 0;    // History: end of the next chunk to read; NVS: next game number
+        uint32_t oldest_ = 1;  // NVS: oldest game number still in the ring
+    };
+
     /// Get total number of games played (lifetime counter)
     /// @return Total game count
     uint32_t get_total_game_count();
@@ -44,10 +98,29 @@ private:
     GameLog(const GameLog&) = delete;
     GameLog& operator=(const GameLog&) = delete;
 
-    static constexpr const char* NAMESPACE = "poker_chip";
+    /// Copy the game in progress if its first save is queued but not in the history yet
+    bool queued_new_game(GameRecord& record) const;
+
+    /// Slot key for a game number
+    static void slot_key(char prefix, uint32_t game_number, char* key, size_t len);
+
+    /// Write a record to the history, or to its NVS slot if the history is unavailable
+    bool store_record(const GameRecord& record);
+
+    /// Read one NVS fallback slot; false if it does not hold this game
+    bool read_slot(uint32_t game_number, GameRecord& record);
+
+    /// Move records from older formats (single blob, fixed-size "g" slots,
+    /// NVS fallback slots) into the current store
+    void migrate();
+
+    uint32_t game_count_ = 0;       // Lifetime games (head index)
+    uint32_t current_game_ = 0;     // Game number of the game in progress (0 = not saved yet)
+
     static constexpr const char* KEY_GAME_COUNT = "game_count";
-    static constexpr const char* KEY_GAME_BLOB = "game_blob";
-    static constexpr int MAX_GAMES = 50;
+    static constexpr const char* KEY_LEGACY_BLOB = "game_blob";  // Pre-ring-buffer format
+    static constexpr char kSlotPrefix = 'h';        // Encoded records (NVS fallback)
+    static constexpr char kLegacySlotPrefix = 'g';  // Fixed-size records (before record_codec)
 };
 
 } // namespace storage
@@ -4,6 +4,7 @@
 #include <nvs_flash.h>
 #include <nvs.h>
 #include <esp_log.h>
+#include <esp_timer.h>
 
 static const char *TAG = "nvs_storage";
 
@@ -14,10 +15,15 @@ NVSStorage& NVSStorage::instance() {
     return inst;
 }
 
-bool NVSStorage::save_volume(uint8_t volume) {
-    // Initialize NVS if needed
+bool NVSStorage::init() {
+    if (is_ready()) {
+        return true;
+    }
+
+    int64_t start = esp_timer_get_time();
     esp_err_t err = nvs_flash_init();
     if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
+        ESP_LOGW(TAG, "NVS layout outdated, erasing: %s", esp_err_to_name(err));
         ESP_ERROR_CHECK(nvs_flash_erase());
         err = nvs_flash_init();
     }
@@ -32,56 +38,156 @@ bool NVSStorage::save_volume(uint8_t volume) {
         ESP_LOGE(TAG, "NVS open failed: %s", esp_err_to_name(err));
         return false;
     }
+    handle_ = handle;
 
-    err = nvs_set_u8(handle, KEY_VOLUME, volume);
+    ESP_LOGI(TAG, "NVS ready in %lu us", (unsigned long)(esp_timer_get_time() - start));
+    return true;
+}
+
+bool NVSStorage::record(Op op, int64_t start_us, bool ok) {
+    uint32_t elapsed = static_cast<uint32_t>(esp_timer_get_time() - start_us);
+    OpStats& s = stats_[static_cast<size_t>(op)];
+    portENTER_CRITICAL(&stats_lock_);
+    s.count++;
+    s.total_us += elapsed;
+    if (elapsed > s.max_us) {
+        s.max_us = elapsed;
+    }
+    if (!ok) {
+        s.errors++;
+    }
+    portEXIT_CRITICAL(&stats_lock_);
+    return ok;
+}
+
+bool NVSStorage::get_u8(const char* key, uint8_t& value) {
+    if (!is_ready()) {
+        return false;
+    }
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = nvs_get_u8(handle_, key, &value);
+    record(Op::Get, start, err == ESP_OK || err == ESP_ERR_NVS_NOT_FOUND);
+    return err == ESP_OK;
+}
+
+bool NVSStorage::set_u8(const char* key, uint8_t value) {
+    if (!is_ready()) {
+        return false;
+    }
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = nvs_set_u8(handle_, key, value);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "NVS set failed: %s", esp_err_to_name(err));
-        nvs_close(handle);
+        ESP_LOGE(TAG, "NVS set %s failed: %s", key, esp_err_to_name(err));
+    }
+    return record(Op::Set, start, err == ESP_OK);
+}
+
+bool NVSStorage::get_u32(const char* key, uint32_t& value) {
+    if (!is_ready()) {
         return false;
     }
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = nvs_get_u32(handle_, key, &value);
+    record(Op::Get, start, err == ESP_OK || err == ESP_ERR_NVS_NOT_FOUND);
+    return err == ESP_OK;
+}
 
-    err = nvs_commit(handle);
-    nvs_close(handle);
+bool NVSStorage::set_u32(const char* key, uint32_t value) {
+    if (!is_ready()) {
+        return false;
+    }
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = nvs_set_u32(handle_, key, value);
+    if (err != ESP_OK) {
+        ESP_LOGE(TAG, "NVS set %s failed: %s", key, esp_err_to_name(err));
+    }
+    return record(Op::Set, start, err == ESP_OK);
+}
 
-    if (err == ESP_OK) {
-        ESP_LOGI(TAG, "Saved volume: %d", volume);
-        return true;
-    } else {
-        ESP_LOGE(TAG, "NVS commit failed: %s", esp_err_to_name(err));
+bool NVSStorage::get_blob(const char* key, void* data, size_t& length) {
+    if (!is_ready()) {
+        length = 0;
         return false;
     }
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = nvs_get_blob(handle_, key, data, &length);
+    record(Op::Get, start, err == ESP_OK || err == ESP_ERR_NVS_NOT_FOUND);
+    if (err != ESP_OK) {
+        length = 0;
+    }
+    return err == ESP_OK;
 }
 
-uint8_t NVSStorage::load_volume(uint8_t default_value) {
-    // Initialize NVS if needed
-    esp_err_t err = nvs_flash_init();
-    if (err == ESP_ERR_NVS_NO_FREE_PAGES || err == ESP_ERR_NVS_NEW_VERSION_FOUND) {
-        ESP_ERROR_CHECK(nvs_flash_erase());
-        err = nvs_flash_init();
+bool NVSStorage::set_blob(const char* key, const void* data, size_t length) {
+    if (!is_ready()) {
+        return false;
     }
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = nvs_set_blob(handle_, key, data, length);
     if (err != ESP_OK) {
-        ESP_LOGE(TAG, "NVS init failed: %s", esp_err_to_name(err));
-        return default_value;
+        ESP_LOGE(TAG, "NVS set %s failed: %s", key, esp_err_to_name(err));
     }
+    return record(Op::Set, start, err == ESP_OK);
+}
 
-    nvs_handle_t handle;
-    err = nvs_open(NAMESPACE, NVS_READONLY, &handle);
+bool NVSStorage::erase_key(const char* key) {
+    if (!is_ready()) {
+        return false;
+    }
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = nvs_erase_key(handle_, key);
+    bool ok = err == ESP_OK || err == ESP_ERR_NVS_NOT_FOUND;
+    if (!ok) {
+        ESP_LOGE(TAG, "NVS erase %s failed: %s", key, esp_err_to_name(err));
+    }
+    return record(Op::Set, start, ok);
+}
+
+bool NVSStorage::commit() {
+    if (!is_ready()) {
+        return false;
+    }
+    int64_t start = esp_timer_get_time();
+    esp_err_t err = nvs_commit(handle_);
     if (err != ESP_OK) {
-        ESP_LOGI(TAG, "NVS open failed (using default): %s", esp_err_to_name(err));
-        return default_value;
+        ESP_LOGE(TAG, "NVS commit failed: %s", esp_err_to_name(err));
     }
+    return record(Op::Commit, start, err == ESP_OK);
+}
 
+bool NVSStorage::stage_volume(uint8_t volume) {
+    return set_u8(KEY_VOLUME, volume);
+}
+
+bool NVSStorage::save_volume(uint8_t volume) {
+    if (!stage_volume(volume) || !commit()) {
+        return false;
+    }
+    ESP_LOGI(TAG, "Saved volume: %d", volume);
+    return true;
+}
+
+uint8_t NVSStorage::load_volume(uint8_t default_value) {
     uint8_t volume = default_value;
-    err = nvs_get_u8(handle, KEY_VOLUME, &volume);
-    nvs_close(handle);
-
-    if (err == ESP_OK) {
-        ESP_LOGI(TAG, "Loaded volume: %d", volume);
-        return volume;
-    } else {
-        ESP_LOGI(TAG, "NVS get failed (using default): %s", esp_err_to_name(err));
+    if (!get_u8(KEY_VOLUME, volume)) {
+        ESP_LOGI(TAG, "No saved volume (using default %d)", default_value);
         return default_value;
     }
+    ESP_LOGI(TAG, "Loaded volume: %d", volume);
+    return volume;
+}
+
+void NVSStorage::log_stats() const {
+    static constexpr const char* kOpNames[] = {"get", "set", "commit"};
+    for (size_t i = 0; i < static_cast<size_t>(Op::Count); i++) {
+        const OpStats& s = stats_[i];
+        if (s.count == 0) {
+            continue;
+        }
+        ESP_LOGI(TAG, "%s: n=%lu err=%lu avg=%lu us max=%lu us", kOpNames[i],
+                 (unsigned long)s.count, (unsigned long)s.errors,
+                 (unsigned long)(s.total_us / s.count), (unsigned long)s.max_us);
+    }
 }
 
 } // namespace storage
@@ -3,24 +3,83 @@
 
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <freertos/FreeRTOS.h>
+#include <nvs.h>
 
 namespace storage {
 
+/// Storage service for the app's NVS namespace.
+/// NVS is initialized and the namespace opened once at boot (init()); every
+/// other call reuses that handle. Writes are staged until commit().
+/// Each operation is timed so the cost of storage on the UI task is visible.
 class NVSStorage {
 public:
+    /// Timed operation kinds
+    enum class Op : uint8_t { Get, Set, Commit, Count };
+
+    /// Latency statistics for one operation kind
+    struct OpStats {
+        uint32_t count = 0;
+        uint32_t errors = 0;     // Failed calls (a missing key on get is not an error)
+        uint64_t total_us = 0;
+        uint32_t max_us = 0;
+    };
+
     static NVSStorage& instance();
 
+    /// Initialize NVS flash and open the namespace (call once at boot).
+    /// Erases and re-initializes the partition if its layout is outdated.
+    /// @return true if storage is usable
+    bool init();
+
+    /// True once init() has succeeded
+    bool is_ready() const { return handle_ != 0; }
+
+    // Typed access. Getters leave the output untouched and return false
+    // if the key is missing or storage is not ready.
+    bool get_u8(const char* key, uint8_t& value);
+    bool set_u8(const char* key, uint8_t value);
+    bool get_u32(const char* key, uint32_t& value);
+    bool set_u32(const char* key, uint32_t value);
+
+    /// Read a blob
+    /// @param length In: buffer size, out: bytes read
+    bool get_blob(const char* key, void* data, size_t& length);
+    bool set_blob(const char* key, const void* data, size_t length);
+
+    /// Remove a key (missing keys count as success)
+    bool erase_key(const char* key);
+
+    /// Write staged changes to flash
+    bool commit();
+
     // Volume storage (0-10 scale)
     bool save_volume(uint8_t volume);
+    bool stage_volume(uint8_t volume);  // Without commit
     uint8_t load_volume(uint8_t default_value = 5);
 
+    /// Get latency statistics for an operation kind
+    const OpStats& stats(Op op) const { return stats_[static_cast<size_t>(op)]; }
+
+    /// Log latency statistics
+    void log_stats() const;
+
 private:
     NVSStorage() = default;
     ~NVSStorage() = default;
     NVSStorage(const NVSStorage&) = delete;
     NVSStorage& operator=(const NVSStorage&) = delete;
 
+    /// Record one timed operation
+    /// @return ok
+    bool record(Op op, int64_t start_us, bool ok);
+
+    nvs_handle_t handle_ = 0;
+    OpStats stats_[static_cast<size_t>(Op::Count)];
+    portMUX_TYPE stats_lock_ = portMUX_INITIALIZER_UNLOCKED;  // UI and storage tasks both record
+
     static constexpr const char* NAMESPACE = "poker_chip";
     static constexpr const char* KEY_VOLUME = "volume";
 };
@@ -0,0 +1,112 @@
+// SPDX-License-Identifier: CC-BY-NC-4.0
+
+#include "record_codec.hpp"
+
+namespace storage {
+namespace codec {
+
+namespace {
+constexpr uint8_t kModeMask = 0x03;
+constexpr uint8_t kFlagPaused = 0x04;
+
+uint8_t* put_varint(uint8_t* out, uint32_t value) {
+    while (value >= 0x80) {
+        *out++ = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    *out++ = static_cast<uint8_t>(value);
+    return out;
+}
+
+// Returns false if the varint runs past end or does not fit 32 bits
+bool get_varint(const uint8_t*& in, const uint8_t* end, uint32_t& value) {
+    value = 0;
+    for (int shift = 0; shift < 35 && in < end; shift += 7) {
+        uint8_t byte = *in++;
+        value |= static_cast<uint32_t>(byte & 0x7F) << shift;
+        if ((byte & 0x80) == 0) {
+            return shift < 28 || byte < 0x10;
+        }
+    }
+    return false;
+}
+
+uint32_t zigzag(int32_t value) {
+    return (static_cast<uint32_t>(value) << 1) ^ static_cast<uint32_t>(value >> 31);
+}
+
+int32_t unzigzag(uint32_t value) {
+    return static_cast<int32_t>(value >> 1) ^ -static_cast<int32_t>(value & 1);
+}
+}
+
+size_t encode(const GameRecord& record, uint32_t prev_number, uint8_t* out) {
+    uint8_t* p = out + 1;
+    p = put_varint(p, zigzag(static_cast<int32_t>(record.game_number - prev_number - 1)));
+
+    uint8_t flags = record.blind_mode & kModeMask;
+    if (record.paused_seconds != 0) {
+        flags |= kFlagPaused;
+    }
+    *p++ = flags;
+
+    p = put_varint(p, record.round_minutes);
+    p = put_varint(p, record.starting_small_blind);
+    p = put_varint(p, record.max_round);
+    p = put_varint(p, record.game_seconds);
+    if (flags & kFlagPaused) {
+        p = put_varint(p, record.paused_seconds);
+    }
+
+    out[0] = static_cast<uint8_t>(p - out - 1);
+    return p - out;
+}
+
+size_t decode(const uint8_t* in, size_t available, uint32_t prev_number, GameRecord& record) {
+    if (available < 1 || in[0] == 0 || in[0] >= available) {
+        return 0;
+    }
+    const uint8_t* p = in + 1;
+    const uint8_t* end = p + in[0];
+
+    uint32_t delta, round_minutes, small_blind, max_round;
+    if (!get_varint(p, end, delta) || p >= end) {
+        return 0;
+    }
+    uint8_t flags = *p++;
+    GameRecord decoded = {};
+    decoded.game_number = prev_number + 1 + static_cast<uint32_t>(unzigzag(delta));
+    decoded.blind_mode = flags & kModeMask;
+    if (!get_varint(p, end, round_minutes) || !get_varint(p, end, small_blind) ||
+        !get_varint(p, end, max_round) || !get_varint(p, end, decoded.game_seconds)) {
+        return 0;
+    }
+    if ((flags & kFlagPaused) && !get_varint(p, end, decoded.paused_seconds)) {
+        return 0;
+    }
+    if (round_minutes > UINT8_MAX || small_blind > UINT16_MAX || max_round > UINT16_MAX) {
+        return 0;
+    }
+    decoded.round_minutes = static_cast<uint8_t>(round_minutes);
+    decoded.starting_small_blind = static_cast<uint16_t>(small_blind);
+    decoded.max_round = static_cast<uint16_t>(max_round);
+
+    // Bytes after the known fields belong to a newer writer and are skipped
+    record = decoded;
+    return end - in;
+}
+
+GameRecord from_legacy(const LegacyRecord& legacy) {
+    GameRecord record = {};
+    record.game_number = legacy.game_number;
+    record.game_seconds = legacy.game_seconds;
+    record.paused_seconds = legacy.paused_seconds;
+    record.max_round = legacy.max_round;
+    record.starting_small_blind = legacy.starting_small_blind;
+    record.round_minutes = legacy.round_minutes;
+    record.blind_mode = legacy.blind_mode;
+    return record;
+}
+
+} // namespace codec
+} // namespace storage
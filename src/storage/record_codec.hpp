@@ -0,0 +1,60 @@
+// SPDX-License-Identifier: CC-BY-NC-4.0
+// Compact variable-length encoding for game records
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include "game_log.hpp"
+
+namespace storage {
+namespace codec {
+
+/// Encoded record layout (version 2):
+///
+///     uint8   payload length (lets readers skip fields they do not know)
+///     varint  zigzag(game_number - prev_number - 1)   0 for the next game in sequence
+///     uint8   flags: bits 0-1 blind_mode, bit 2 paused_seconds present
+///     varint  round_minutes
+///     varint  starting_small_blind
+///     varint  max_round
+///     varint  game_seconds
+///     varint  paused_seconds                           only if flagged
+///
+/// Varints are LEB128 (7 bits per byte, low bits first). A typical record
+/// takes 8-10 bytes instead of 20. prev_number is the previous record's
+/// game_number, or 0 to make a record decodable on its own.
+constexpr uint16_t kVersion = 2;
+
+/// Largest encoded record, length byte included
+constexpr size_t kMaxEncodedSize = 1 + 5 + 1 + 5 + 5 + 5 + 5 + 5;
+
+/// Encode a record
+/// @param out Buffer of at least kMaxEncodedSize bytes
+/// @return Bytes written
+size_t encode(const GameRecord& record, uint32_t prev_number, uint8_t* out);
+
+/// Decode one record
+/// @param in Encoded bytes
+/// @param available Bytes available at in
+/// @return Bytes consumed, or 0 if the record is truncated or malformed
+size_t decode(const uint8_t* in, size_t available, uint32_t prev_number, GameRecord& record);
+
+/// Fixed 20-byte record written before version 2 (NVS slots, "game_blob", version 1 history files)
+struct LegacyRecord {
+    uint32_t game_number;
+    uint32_t game_seconds;
+    uint32_t paused_seconds;
+    uint16_t max_round;
+    uint8_t starting_small_blind;
+    uint8_t round_minutes;
+    uint8_t blind_mode;
+    uint8_t reserved;
+};
+static_assert(sizeof(LegacyRecord) == 20, "LegacyRecord must match the stored layout");
+
+/// Convert a legacy record
+GameRecord from_legacy(const LegacyRecord& legacy);
+
+} // namespace codec
+} // namespace storage
@@ -0,0 +1,229 @@
+// SPDX-License-Identifier: CC-BY-NC-4.0
+
+#include "storage_writer.hpp"
+#include "event_journal.hpp"
+#include "nvs_storage.hpp"
+#include "hardware/config.hpp"
+#include <esp_log.h>
+#include <esp_timer.h>
+#include <initializer_list>
+
+static const char *TAG = "storage_writer";
+
+namespace storage {
+
+StorageWriter& StorageWriter::instance() {
+    static StorageWriter inst;
+    return inst;
+}
+
+void StorageWriter::init() {
+    if (task_ != nullptr) {
+        return;
+    }
+    flushed_ = xSemaphoreCreateBinary();
+    xTaskCreatePinnedToCore(task_entry, "storage_wr", kTaskStackSize, this, tskIDLE_PRIORITY + 2, &task_,
+                            portNUM_PROCESSORS - 1);
+    ESP_LOGI(TAG, "Writer task started");
+}
+
+void StorageWriter::kick() {
+    int64_t deadline = esp_timer_get_time() + hardware::config::storage::WRITE_DELAY_MS * 1000LL;
+    portENTER_CRITICAL(&lock_);
+    if (deadline_us_ == 0) {
+        deadline_us_ = deadline;
+    }
+    portEXIT_CRITICAL(&lock_);
+    if (task_ != nullptr) {
+        xTaskNotify(task_, kNotifyKick, eSetBits);
+    }
+}
+
+void StorageWriter::save_volume(uint8_t volume) {
+    portENTER_CRITICAL(&lock_);
+    stats_.submitted++;
+    if (pending_.volume_dirty) {
+        stats_.coalesced++;
+    }
+    pending_.volume_dirty = true;
+    pending_.volume = volume;
+    portEXIT_CRITICAL(&lock_);
+    kick();
+}
+
+uint8_t StorageWriter::load_volume(uint8_t default_value) {
+    portENTER_CRITICAL(&lock_);
+    bool dirty = pending_.volume_dirty;
+    uint8_t volume = pending_.volume;
+    portEXIT_CRITICAL(&lock_);
+    if (dirty) {
+        return volume;
+    }
+    return NVSStorage::instance().load_volume(default_value);
+}
+
+void StorageWriter::save_game(const GameRecord& record, bool new_game) {
+    bool full = false;
+    portENTER_CRITICAL(&lock_);
+    stats_.submitted++;
+    int slot = 0;
+    while (slot < pending_.game_count && pending_.games[slot].game_number != record.game_number) {
+        slot++;
+    }
+    if (slot < pending_.game_count) {
+        // Same game already pending: keep the newest record, remember it starts a game
+        stats_.coalesced++;
+        pending_.games[slot] = record;
+        pending_.game_new[slot] = pending_.game_new[slot] || new_game;
+    } else if (pending_.game_count < kMaxPendingGames) {
+        pending_.games[pending_.game_count] = record;
+        pending_.game_new[pending_.game_count] = new_game;
+        pending_.game_count++;
+    } else {
+        stats_.dropped++;
+        full = true;
+    }
+    bool queue_full = pending_.game_count >= kMaxPendingGames;
+    portEXIT_CRITICAL(&lock_);
+
+    if (full) {
+        ESP_LOGW(TAG, "Write queue full, game #%lu not saved", (unsigned long)record.game_number);
+    }
+    kick();
+    if (queue_full && task_ != nullptr) {
+        xTaskNotify(task_, kNotifyFlush, eSetBits);  // Make room without waiting for the deadline
+    }
+}
+
+bool StorageWriter::pending_game(uint32_t game_number, GameRecord& record) {
+    bool found = false;
+    portENTER_CRITICAL(&lock_);
+    // Queued records are newer than the batch being written
+    for (const Pending* batch : {&pending_, &writing_}) {
+        for (int i = 0; i < batch->game_count && !found; i++) {
+            if (batch->games[i].game_number == game_number) {
+                record = batch->games[i];
+                found = true;
+            }
+        }
+    }
+    portEXIT_CRITICAL(&lock_);
+    return found;
+}
+
+bool StorageWriter::flush(uint32_t timeout_ms) {
+    if (task_ == nullptr) {
+        // No writer task (not started): write on the caller
+        write_batch();
+        return true;
+    }
+
+    portENTER_CRITICAL(&lock_);
+    bool idle = pending_.empty() && writing_.empty();
+    portEXIT_CRITICAL(&lock_);
+    idle = idle && !EventJournal::instance().has_pending();
+    if (idle) {
+        return true;
+    }
+
+    xSemaphoreTake(flushed_, 0);  // Clear a stale completion
+    xTaskNotify(task_, kNotifyFlush, eSetBits);
+    bool done = xSemaphoreTake(flushed_, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+    if (!done) {
+        ESP_LOGW(TAG, "Flush timed out after %lu ms", (unsigned long)timeout_ms);
+    }
+    return done;
+}
+
+void StorageWriter::task_entry(void* arg) {
+    static_cast<StorageWriter*>(arg)->run();
+}
+
+void StorageWriter::run() {
+    for (;;) {
+        portENTER_CRITICAL(&lock_);
+        int64_t deadline = deadline_us_;
+        portEXIT_CRITICAL(&lock_);
+
+        TickType_t wait = portMAX_DELAY;
+        if (deadline != 0) {
+            int64_t remaining_us = deadline - esp_timer_get_time();
+            wait = remaining_us > 0 ? pdMS_TO_TICKS((remaining_us + 999) / 1000) + 1 : 0;
+        }
+
+        uint32_t bits = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &bits, wait);
+
+        bool flush = bits & kNotifyFlush;
+        if (!flush) {
+            portENTER_CRITICAL(&lock_);
+            deadline = deadline_us_;
+            portEXIT_CRITICAL(&lock_);
+            if (deadline == 0 || esp_timer_get_time() < deadline) {
+                continue;  // Woken by a new write; keep waiting for the deadline
+            }
+        }
+
+        // Writes queued while a batch commits go out in the next batch
+        while (write_batch()) {
+        }
+        if (flush) {
+            xSemaphoreGive(flushed_);
+        }
+    }
+}
+
+bool StorageWriter::write_batch() {
+    Pending batch;
+    portENTER_CRITICAL(&lock_);
+    batch = pending_;
+    writing_ = pending_;
+    pending_ = Pending();
+    deadline_us_ = 0;
+    portEXIT_CRITICAL(&lock_);
+
+    auto& journal = EventJournal::instance();
+    if (batch.empty()) {
+        return journal.write_pending() > 0;
+    }
+
+    int64_t start = esp_timer_get_time();
+    auto& nvs = NVSStorage::instance();
+    if (batch.volume_dirty) {
+        nvs.stage_volume(batch.volume);
+    }
+    for (int i = 0; i < batch.game_count; i++) {
+        GameLog::instance().stage_record(batch.games[i], batch.game_new[i]);
+    }
+    nvs.commit();
+    if (batch.game_count > 0) {
+        GameLog::instance().sync();
+    }
+    journal.write_pending();
+
+    portENTER_CRITICAL(&lock_);
+    writing_ = Pending();
+    portEXIT_CRITICAL(&lock_);
+
+    uint32_t elapsed = static_cast<uint32_t>(esp_timer_get_time() - start);
+    stats_.batches++;
+    if (elapsed > stats_.max_batch_us) {
+        stats_.max_batch_us = elapsed;
+    }
+    ESP_LOGD(TAG, "Batch written in %lu us (volume=%d, games=%d)",
+             (unsigned long)elapsed, batch.volume_dirty, batch.game_count);
+    return true;
+}
+
+void StorageWriter::log_stats() const {
+    ESP_LOGI(TAG, "Writes: submitted=%lu coalesced=%lu dropped=%lu batches=%lu max_batch=%lu us",
+             (unsigned long)stats_.submitted, (unsigned long)stats_.coalesced, (unsigned long)stats_.dropped,
+             (unsigned long)stats_.batches, (unsigned long)stats_.max_batch_us);
+    ESP_LOGI(TAG, "Journal events dropped: %lu", (unsigned long)EventJournal::instance().dropped());
+    if (task_ != nullptr) {
+        ESP_LOGI(TAG, "Task stack headroom: %u of %u bytes", (unsigned)uxTaskGetStackHighWaterMark(task_),
+                 (unsigned)kTaskStackSize);
+    }
+}
+
+} // namespace storage
@@ -0,0 +1,105 @@
+// SPDX-License-Identifier: CC-BY-NC-4.0
+// Write-behind storage task so the UI task never waits on flash
+
+#pragma once
+
+#include <cstdint>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+#include "game_log.hpp"
+
+namespace storage {
+
+/// Asynchronous NVS and history writer.
+/// The UI task hands over writes and returns immediately; a low-priority task
+/// batches them into one commit WRITE_DELAY_MS after the first pending write.
+/// Pending writes are keyed (volume, one entry per game), so repeated writes
+/// to the same key coalesce and the queue stays bounded.
+class StorageWriter {
+public:
+    /// Write counters
+    struct Stats {
+        uint32_t submitted = 0;   // Writes handed over
+        uint32_t coalesced = 0;   // Writes that replaced a pending one
+        uint32_t dropped = 0;     // Writes lost because the queue was full
+        uint32_t batches = 0;     // Commits performed
+        uint32_t max_batch_us = 0;
+    };
+
+    static StorageWriter& instance();
+
+    /// Start the writer task (call once after NVSStorage::init())
+    void init();
+
+    /// Queue the volume setting (0-10 scale)
+    void save_volume(uint8_t volume);
+
+    /// Volume including a write that has not reached flash yet
+    uint8_t load_volume(uint8_t default_value = 5);
+
+    /// Queue a game record
+    /// @param new_game True for the first save of a game (advances the log head)
+    void save_game(const GameRecord& record, bool new_game);
+
+    /// Copy a game record that is queued but not written yet
+    /// @return true if game_number is pending
+    bool pending_game(uint32_t game_number, GameRecord& record);
+
+    /// Schedule a write of data queued elsewhere (EventJournal)
+    void request_write() { kick(); }
+
+    /// Write everything pending now and wait for it (blocks; use before power-off)
+    /// @param timeout_ms Longest time to wait
+    /// @return true if nothing is left pending
+    bool flush(uint32_t timeout_ms);
+
+    /// Get write counters
+    const Stats& stats() const { return stats_; }
+
+    /// Log write counters
+    void log_stats() const;
+
+private:
+    StorageWriter() = default;
+    StorageWriter(const StorageWriter&) = delete;
+    StorageWriter& operator=(const StorageWriter&) = delete;
+
+    static constexpr int kMaxPendingGames = 4;
+    static constexpr uint32_t kTaskStackSize = 4096;  // LittleFS append + fsync; headroom in log_stats()
+
+    /// Everything waiting to be written (at most one entry per key)
+    struct Pending {
+        bool volume_dirty = false;
+        uint8_t volume = 0;
+        int game_count = 0;
+        GameRecord games[kMaxPendingGames];
+        bool game_new[kMaxPendingGames];
+
+        bool empty() const { return !volume_dirty && game_count == 0; }
+    };
+
+    enum Notify : uint32_t {
+        kNotifyKick = 1u << 0,   // New pending write (re-arm the deadline)
+        kNotifyFlush = 1u << 1,  // Write now
+    };
+
+    static void task_entry(void* arg);
+    void run();
+
+    /// Write one batch; returns true if anything was written
+    bool write_batch();
+
+    /// Arm the write deadline and wake the task (call with lock_ held released)
+    void kick();
+
+    TaskHandle_t task_ = nullptr;
+    SemaphoreHandle_t flushed_ = nullptr;
+    portMUX_TYPE lock_ = portMUX_INITIALIZER_UNLOCKED;
+    Pending pending_;
+    Pending writing_;          // Batch being written (still readable until committed)
+    int64_t deadline_us_ = 0;  // 0 = nothing pending
+    Stats stats_;
+};
+
+} // namespace storage
@@ -0,0 +1,133 @@
+#include "event_loop.hpp"
+
+#include <driver/gpio.h>
+#include <esp_attr.h>
+#include <esp_log.h>
+#include "hardware/config.hpp"
+
+namespace tasks {
+
+namespace {
+constexpr const char* kLogTag = "event_loop";
+
+void add_edge_wake(gpio_num_t pin, gpio_int_type_t type, uint32_t bits, void (*isr)(void*)) {
+    gpio_set_intr_type(pin, type);
+    esp_err_t err = gpio_isr_handler_add(pin, isr, reinterpret_cast<void*>(static_cast<uintptr_t>(bits)));
+    if (err != ESP_OK) {
+        ESP_LOGW(kLogTag, "Failed to add wake ISR on GPIO %d: %s", pin, esp_err_to_name(err));
+        return;
+    }
+    gpio_intr_enable(pin);
+}
+}
+
+EventLoop& EventLoop::instance() {
+    static EventLoop instance;
+    return instance;
+}
+
+void EventLoop::init() {
+    task_ = xTaskGetCurrentTaskHandle();
+
+    // ISR service may already be installed by another driver
+    esp_err_t err = gpio_install_isr_service(0);
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) {
+        ESP_LOGE(kLogTag, "GPIO ISR service install failed: %s", esp_err_to_name(err));
+    }
+
+    namespace pins = hardware::config::pins;
+
+    // Encoder pins stay owned by PCNT; we only listen for edges to wake up.
+    // Button A owns its own interrupt and wakes us via notify(kWakeButton).
+    add_edge_wake(pins::ENCODER_A, GPIO_INTR_ANYEDGE, kWakeEncoder, gpio_isr);
+    add_edge_wake(pins::ENCODER_B, GPIO_INTR_ANYEDGE, kWakeEncoder, gpio_isr);
+
+    gpio_config_t touch_cfg = {};
+    touch_cfg.pin_bit_mask = 1ULL << pins::TOUCH_INT;
+    touch_cfg.mode = GPIO_MODE_INPUT;
+    touch_cfg.pull_up_en = GPIO_PULLUP_ENABLE;
+    touch_cfg.pull_down_en = GPIO_PULLDOWN_DISABLE;
+    touch_cfg.intr_type = GPIO_INTR_DISABLE;
+    gpio_config(&touch_cfg);
+    add_edge_wake(pins::TOUCH_INT, GPIO_INTR_NEGEDGE, kWakeTouch, gpio_isr);
+
+    esp_timer_create_args_t timer_args = {};
+    timer_args.callback = game_tick_cb;
+    timer_args.arg = this;
+    timer_args.name = "game_tick";
+    ESP_ERROR_CHECK(esp_timer_create(&timer_args, &tick_timer_));
+    game_clock_.start(esp_timer_get_time());
+    ESP_ERROR_CHECK(esp_timer_start_periodic(tick_timer_, kGameTickUs));
+
+    ESP_LOGI(kLogTag, "Initialized (task %p)", static_cast<void*>(task_));
+}
+
+uint32_t EventLoop::wait(uint32_t timeout_ms) {
+    // Round up so a short LVGL deadline never becomes a zero-tick spin
+    TickType_t ticks = (timeout_ms + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+
+    uint32_t bits = 0;
+    xTaskNotifyWait(0, UINT32_MAX, &bits, ticks);
+
+    counters_.total++;
+    if (bits == 0) {
+        counters_.deadline++;
+    }
+    if (bits & kWakeEncoder) {
+        counters_.encoder++;
+    }
+    if (bits & kWakeButton) {
+        counters_.button++;
+    }
+    if (bits & kWakeTouch) {
+        counters_.touch++;
+    }
+    if (bits & kWakeGameTick) {
+        counters_.game_tick++;
+    }
+    return bits;
+}
+
+void EventLoop::notify(uint32_t bits) {
+    if (task_ != nullptr) {
+        xTaskNotify(task_, bits, eSetBits);
+    }
+}
+
+void IRAM_ATTR EventLoop::notify_from_isr(uint32_t bits) {
+    if (task_ == nullptr) {
+        return;
+    }
+    BaseType_t woken = pdFALSE;
+    xTaskNotifyFromISR(task_, bits, eSetBits, &woken);
+    if (woken == pdTRUE) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+void EventLoop::restart_game_tick() {
+    if (tick_timer_ == nullptr) {
+        return;
+    }
+    esp_timer_stop(tick_timer_);
+    // Start the clock first so the timer never fires ahead of its deadline
+    game_clock_.start(esp_timer_get_time());
+    esp_timer_start_periodic(tick_timer_, kGameTickUs);
+}
+
+void EventLoop::log_counters() const {
+    ESP_LOGI(kLogTag, "Wakes: total=%lu deadline=%lu tick=%lu encoder=%lu button=%lu touch=%lu",
+             counters_.total, counters_.deadline, counters_.game_tick,
+             counters_.encoder, counters_.button, counters_.touch);
+}
+
+void EventLoop::game_tick_cb(void* arg) {
+    // Ticks are counted by game_clock_ from the deadlines; this is only the wake-up
+    static_cast<EventLoop*>(arg)->notify(kWakeGameTick);
+}
+
+void IRAM_ATTR EventLoop::gpio_isr(void* arg) {
+    instance().notify_from_isr(static_cast<uint32_t>(reinterpret_cast<uintptr_t>(arg)));
+}
+
+} // namespace tasks
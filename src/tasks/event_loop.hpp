@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstdint>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
+#include <esp_timer.h>
+#include "util/deadline_ticker.hpp"
+
+namespace tasks {
+
+/// Single wake-up point for the UI task.
+/// The main loop blocks in wait() until an input interrupt, the 1 Hz game
+/// tick, or the LVGL timer deadline wakes it, instead of polling on a fixed
+/// delay. Wake sources are delivered as task notification bits.
+class EventLoop {
+public:
+    /// Wake reasons (bit flags returned by wait())
+    enum Wake : uint32_t {
+        kWakeEncoder  = 1u << 0,
+        kWakeButton   = 1u << 1,
+        kWakeTouch    = 1u << 2,
+        kWakeGameTick = 1u << 3,
+        kWakeInput    = kWakeEncoder | kWakeButton | kWakeTouch,
+    };
+
+    /// Number of loop wake-ups per reason since init().
+    /// A single wake-up may count towards several reasons.
+    struct WakeCounters {
+        uint32_t encoder = 0;
+        uint32_t button = 0;
+        uint32_t touch = 0;
+        uint32_t game_tick = 0;
+        uint32_t deadline = 0;  // Timed out waiting (LVGL timer due)
+        uint32_t total = 0;
+    };
+
+    /// Get the singleton instance
+    static EventLoop& instance();
+
+    /// Bind to the calling task, install input interrupts and start the game tick.
+    /// Must be called from the task that will call wait().
+    void init();
+
+    /// Block until an event arrives or the timeout expires
+    /// @param timeout_ms Maximum time to sleep (rounded up to the RTOS tick)
+    /// @return Wake bits that fired (0 = timeout)
+    uint32_t wait(uint32_t timeout_ms);
+
+    /// Wake the loop from task context (safe before init(): ignored)
+    void notify(uint32_t bits);
+
+    /// Wake the loop from an ISR
+    void notify_from_isr(uint32_t bits);
+
+    /// Take the number of 1 Hz game ticks whose deadlines have passed since the last call.
+    /// Counted from absolute deadlines, so late loop iterations never lose or shift ticks.
+    uint32_t take_game_ticks() { return game_clock_.take(esp_timer_get_time()); }
+
+    /// Restart the 1 Hz tick phase so the next tick is a full second away
+    void restart_game_tick();
+
+    /// Get wake-up counters
+    const WakeCounters& counters() const { return counters_; }
+
+    /// Log wake-up counters
+    void log_counters() const;
+
+private:
+    EventLoop() = default;
+    EventLoop(const EventLoop&) = delete;
+    EventLoop& operator=(const EventLoop&) = delete;
+
+    static void game_tick_cb(void* arg);
+    static void gpio_isr(void* arg);
+
+    TaskHandle_t task_ = nullptr;
+    esp_timer_handle_t tick_timer_ = nullptr;
+    WakeCounters counters_;
+
+    static constexpr uint64_t kGameTickUs = 1000000;  // 1 second
+
+    // Only touched from the loop task; the timer just wakes it at each deadline
+    util::DeadlineTicker game_clock_{kGameTickUs};
+};
+
+} // namespace tasks
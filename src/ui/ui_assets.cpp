@@ -1,12 +1,138 @@
 #include "ui_assets.hpp"
 
+#include <M5Unified.hpp>
+#include <cstring>
+#include <esp_log.h>
 #include <lvgl.h>
 
+// Generated from src/images/riccy.png by tools/png_to_rgb565.py
+extern const uint8_t _binary_riccy_rgb565_start[];
+extern const uint8_t _binary_riccy_rgb565_end[];
+
 namespace ui::assets
 {
+namespace
+{
+constexpr const char *kLogTag = "ui_assets";
+
+// Decoded rows are pushed in bands; two buffers so one decodes while the other is sent by DMA
+constexpr size_t kBandPixels = 240 * 10;
+uint16_t s_band[2][kBandPixels] __attribute__((aligned(4)));
+
+// RLE packet control byte (see tools/png_to_rgb565.py)
+constexpr uint8_t kRepeatFlag = 0x80;
+}
+
 void init()
 {
-    // TODO: Mount LittleFS and load runtime assets when available.
+    // No runtime assets yet (see header)
+}
+
+bool draw_splash(int32_t x, int32_t y)
+{
+    const uint8_t *src = _binary_riccy_rgb565_start;
+    const uint8_t *const end = _binary_riccy_rgb565_end;
+    if (end - src < 4)
+    {
+        ESP_LOGW(kLogTag, "Splash image missing");
+        return false;
+    }
+
+    const int32_t width = src[0] | (src[1] << 8);
+    const int32_t height = src[2] | (src[3] << 8);
+    src += 4;
+    if (width == 0 || static_cast<size_t>(width) > kBandPixels)
+    {
+        ESP_LOGW(kLogTag, "Unsupported splash size %ldx%ld", (long)width, (long)height);
+        return false;
+    }
+
+    const int32_t band_rows = kBandPixels / width;
+    size_t literal_left = 0;
+    size_t repeat_left = 0;
+    uint16_t repeat_px = 0;
+    bool ok = true;
+    int buf = 0;
+
+    M5.Display.startWrite();
+    for (int32_t row = 0; row < height; row += band_rows)
+    {
+        const int32_t rows = LV_MIN(band_rows, height - row);
+        const size_t count = static_cast<size_t>(rows) * width;
+        uint16_t *dst = s_band[buf];
+
+        // Pixels are copied as raw bytes so they stay in panel byte order
+        size_t i = 0;
+        while (i < count)
+        {
+            if (repeat_left > 0)
+            {
+                size_t n = LV_MIN(repeat_left, count - i);
+                for (size_t k = 0; k < n; k++)
+                {
+                    dst[i + k] = repeat_px;
+                }
+                i += n;
+                repeat_left -= n;
+            }
+            else if (literal_left > 0)
+            {
+                size_t n = LV_MIN(literal_left, count - i);
+                if (static_cast<size_t>(end - src) < n * 2)
+                {
+                    ok = false;
+                    break;
+                }
+                memcpy(&dst[i], src, n * 2);
+                src += n * 2;
+                i += n;
+                literal_left -= n;
+            }
+            else
+            {
+                if (src >= end)
+                {
+                    ok = false;
+                    break;
+                }
+                uint8_t control = *src++;
+                if (control & kRepeatFlag)
+                {
+                    if (end - src < 2)
+                    {
+                        ok = false;
+                        break;
+                    }
+                    memcpy(&repeat_px, src, 2);
+                    src += 2;
+                    repeat_left = (control & ~kRepeatFlag) + 2;
+                }
+                else
+                {
+                    literal_left = control + 1;
+                }
+            }
+        }
+
+        if (!ok)
+        {
+            memset(&dst[i], 0, (count - i) * 2);
+        }
+        M5.Display.pushImageDMA(x, y + row, width, rows, reinterpret_cast<const lgfx::swap565_t *>(dst));
+        if (!ok)
+        {
+            break;
+        }
+        buf ^= 1;
+    }
+    M5.Display.waitDMA();
+    M5.Display.endWrite();
+
+    if (!ok)
+    {
+        ESP_LOGW(kLogTag, "Splash image truncated");
+    }
+    return ok;
 }
 
 bool apply_boot_logo(lv_obj_t *obj)
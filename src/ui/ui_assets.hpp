@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <lvgl.h>
 
 namespace ui::assets
@@ -14,8 +15,14 @@ struct ImageAsset
 // Returns true if an image was assigned.
 bool apply_boot_logo(lv_obj_t *obj);
 
-// Placeholder for future asset packing hook. Invoked during setup to
-// initialise any runtime asset sources (LittleFS, etc.).
+// Stream the build-time converted splash (RLE RGB565, panel byte order)
+// straight to the display. Call before LVGL starts flushing.
+// Returns false if the embedded image is malformed.
+bool draw_splash(int32_t x, int32_t y);
+
+// Hook for runtime-loaded assets, invoked during setup. Nothing is loaded
+// yet: assets are embedded at build time, and the LittleFS partition
+// (mounted by storage::GameHistory) holds only game data.
 void init();
 }
 
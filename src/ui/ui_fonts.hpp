@@ -0,0 +1,16 @@
+#pragma once
+
+#include <lvgl.h>
+
+/// Glyph subsets of the large Montserrat sizes, generated at build time by
+/// tools/subset_lv_font.py (see src/CMakeLists.txt for the character sets).
+/// Characters outside a subset are drawn with lv_font_montserrat_14.
+/// The fonts are compiled as C, hence the C linkage.
+extern "C"
+{
+    /// 48 px digits and ':' for blind values, setting numbers and the game timer
+    LV_FONT_DECLARE(ui_font_digits_48)
+
+    /// 24 px capital letters for the blind progression mode names
+    LV_FONT_DECLARE(ui_font_caps_24)
+}
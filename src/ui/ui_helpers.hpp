@@ -1,6 +1,8 @@
 #pragma once
 
 #include <lvgl.h>
+#include "chip_set.hpp"
+#include "ui_styles.hpp"
 
 namespace ui {
 namespace helpers {
@@ -36,5 +38,28 @@ inline lv_obj_t* create_label(lv_obj_t* parent) {
     return lv_label_create(parent);
 }
 
+// The chip breakdown overlays have one line per denomination
+static_assert(chips::kDenominationCount == 3, "Chip breakdown overlays show exactly three denominations");
+
+/**
+ * Fills a chip breakdown overlay line ("16 x Blue (25) = 400") and styles it
+ * in the chip's colour, so the overlays always match the rounding engine.
+ * @param index Denomination index into chips::kChipSet
+ */
+inline void set_chip_line(lv_obj_t* label, int index) {
+    const chips::Denomination& chip = chips::kChipSet[index];
+    lv_label_set_text_fmt(label, "%d x %s (%d) = %d",
+                          chip.per_stack, chip.name, chip.value, chip.per_stack * chip.value);
+    ui::styles::apply_chip_line(label, index);
+}
+
+/**
+ * Fills the "Total stack: N" overlay line from the chip set and styles it.
+ */
+inline void set_stack_line(lv_obj_t* label) {
+    lv_label_set_text_fmt(label, "Total stack: %d", chips::starting_stack());
+    ui::styles::apply_detail_text(label);
+}
+
 } // namespace helpers
 } // namespace ui
@@ -3,6 +3,7 @@
 #include <lvgl.h>
 
 #include "ui_assets.hpp"
+#include "ui_styles.hpp"
 
 namespace ui
 {
@@ -13,6 +14,8 @@ namespace ui
 
     void ui_init()
     {
+        styles::init();
+
         lv_disp_t *disp = lv_disp_get_default();
         g_handles.screen = lv_obj_create(nullptr);
         lv_obj_remove_style_all(g_handles.screen);
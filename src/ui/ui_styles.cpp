@@ -1,67 +1,305 @@
 #include "ui_styles.hpp"
 
+#include "chip_set.hpp"
+#include "ui_fonts.hpp"
+
 namespace ui::styles
 {
+    namespace
+    {
+        bool g_initialized = false;
+
+        lv_style_t g_screen_root;
+        lv_style_t g_title_bg;
+        lv_style_t g_title_text;
+        lv_style_t g_big_number;
+        lv_style_t g_bottom_button;
+        lv_style_t g_bottom_button_label;
+        lv_style_t g_info_button;
+        lv_style_t g_info_button_label;
+        lv_style_t g_no_outline;
+        lv_style_t g_overlay_bg;
+        lv_style_t g_option_name;
+        lv_style_t g_option_description;
+        lv_style_t g_hint_text;
+        lv_style_t g_detail_text;
+        lv_style_t g_status_text;
+        lv_style_t g_chip_line[chips::kDenominationCount];
+        lv_style_t g_log_line;
+        lv_style_t g_blind_value[2];
+        lv_style_t g_blind_label[2];
+        lv_style_t g_timer_text;
+        lv_style_t g_align_left;
+        lv_style_t g_align_right;
+        lv_style_t g_menu_item;
+        lv_style_t g_menu_item_divider;
+        lv_style_t g_menu_item_selected;
+        lv_style_t g_centered_text;
+
+        // Zero-time background transition, replacing the theme's delayed one
+        const lv_style_prop_t kInstantProps[] = {LV_STYLE_BG_COLOR, LV_STYLE_PROP_INV};
+        lv_style_transition_dsc_t g_instant;
+
+        constexpr uint32_t kSmallBlindColor = 0x00FF46;
+        constexpr uint32_t kBigBlindColor = 0x00FBFF;
+
+        void init_text(lv_style_t *style, uint32_t color, lv_text_align_t align)
+        {
+            lv_style_init(style);
+            lv_style_set_text_color(style, lv_color_hex(color));
+            lv_style_set_text_align(style, align);
+        }
+
+        void add(lv_obj_t *obj, lv_style_t *style, lv_style_selector_t selector = LV_PART_MAIN)
+        {
+            lv_obj_add_style(obj, style, selector);
+        }
+    } // namespace
+
+    void init()
+    {
+        if (g_initialized)
+        {
+            return;
+        }
+        g_initialized = true;
+
+        lv_style_init(&g_screen_root);
+        lv_style_set_width(&g_screen_root, LV_PCT(100));
+        lv_style_set_height(&g_screen_root, LV_PCT(100));
+
+        lv_style_init(&g_title_bg);
+        lv_style_set_width(&g_title_bg, 280);
+        lv_style_set_height(&g_title_bg, 58);
+        lv_style_set_bg_color(&g_title_bg, lv_color_hex(0x333333));
+        lv_style_set_bg_opa(&g_title_bg, LV_OPA_COVER);
+        lv_style_set_border_width(&g_title_bg, 0);
+        lv_style_set_radius(&g_title_bg, 0);
+
+        init_text(&g_title_text, 0x9A9A9A, LV_TEXT_ALIGN_CENTER);
+
+        init_text(&g_big_number, 0xFF00DC, LV_TEXT_ALIGN_CENTER);
+        lv_style_set_text_font(&g_big_number, &ui_font_digits_48);
+
+        lv_style_init(&g_bottom_button);
+        lv_style_set_width(&g_bottom_button, 240);
+        lv_style_set_height(&g_bottom_button, 60);
+        lv_style_set_bg_color(&g_bottom_button, lv_color_hex(0xDF7B0F));
+        lv_style_set_bg_opa(&g_bottom_button, LV_OPA_COVER);
+        lv_style_set_border_width(&g_bottom_button, 0);
+        lv_style_set_radius(&g_bottom_button, 0);
+        lv_style_set_outline_width(&g_bottom_button, 0);
+
+        init_text(&g_bottom_button_label, 0x000000, LV_TEXT_ALIGN_CENTER);
+
+        lv_style_init(&g_info_button);
+        lv_style_set_width(&g_info_button, 34);
+        lv_style_set_height(&g_info_button, 34);
+        lv_style_set_bg_color(&g_info_button, lv_color_hex(0x666666));
+        lv_style_set_radius(&g_info_button, 17);
+        lv_style_set_border_width(&g_info_button, 2);
+        lv_style_set_border_color(&g_info_button, lv_color_hex(0x999999));
+        lv_style_set_outline_width(&g_info_button, 0);
+
+        lv_style_init(&g_info_button_label);
+        lv_style_set_text_color(&g_info_button_label, lv_color_hex(0xFFFFFF));
+
+        // Overrides the theme's focus outline (added for the focused states only)
+        lv_style_init(&g_no_outline);
+        lv_style_set_outline_width(&g_no_outline, 0);
+
+        lv_style_init(&g_overlay_bg);
+        lv_style_set_width(&g_overlay_bg, 240);
+        lv_style_set_height(&g_overlay_bg, 240);
+        lv_style_set_bg_color(&g_overlay_bg, lv_color_black());
+        lv_style_set_bg_opa(&g_overlay_bg, LV_OPA_90);
+        lv_style_set_border_width(&g_overlay_bg, 0);
+        lv_style_set_pad_all(&g_overlay_bg, 0);
+
+        init_text(&g_option_name, 0xFF00DC, LV_TEXT_ALIGN_CENTER);
+        lv_style_set_text_font(&g_option_name, &ui_font_caps_24);
+
+        init_text(&g_option_description, 0xAAAAAA, LV_TEXT_ALIGN_CENTER);
+        init_text(&g_hint_text, 0x777777, LV_TEXT_ALIGN_CENTER);
+        init_text(&g_detail_text, 0xCCCCCC, LV_TEXT_ALIGN_CENTER);
+        init_text(&g_status_text, 0xFFFFFF, LV_TEXT_ALIGN_CENTER);
+
+        for (int i = 0; i < chips::kDenominationCount; i++)
+        {
+            init_text(&g_chip_line[i], chips::kChipSet[i].color, LV_TEXT_ALIGN_CENTER);
+        }
+
+        init_text(&g_log_line, 0xAAAAAA, LV_TEXT_ALIGN_LEFT);
+
+        const uint32_t blind_colors[2] = {kSmallBlindColor, kBigBlindColor};
+        for (int i = 0; i < 2; i++)
+        {
+            init_text(&g_blind_value[i], blind_colors[i], LV_TEXT_ALIGN_CENTER);
+            lv_style_set_text_font(&g_blind_value[i], &ui_font_digits_48);
+            init_text(&g_blind_label[i], blind_colors[i], LV_TEXT_ALIGN_CENTER);
+        }
+
+        lv_style_init(&g_timer_text);
+        lv_style_set_text_font(&g_timer_text, &ui_font_digits_48);
+        lv_style_set_text_color(&g_timer_text, lv_color_hex(0xFFFFFF));
+
+        lv_style_init(&g_align_left);
+        lv_style_set_text_align(&g_align_left, LV_TEXT_ALIGN_LEFT);
+        lv_style_init(&g_align_right);
+        lv_style_set_text_align(&g_align_right, LV_TEXT_ALIGN_RIGHT);
+
+        // The highlight follows the encoder instantly (the theme would fade it)
+        lv_style_transition_dsc_init(&g_instant, kInstantProps, lv_anim_path_linear, 0, 0, nullptr);
+
+        lv_style_init(&g_menu_item);
+        lv_style_set_width(&g_menu_item, 240);
+        lv_style_set_height(&g_menu_item, 30);
+        lv_style_set_bg_color(&g_menu_item, lv_color_hex(0x555555));
+        lv_style_set_radius(&g_menu_item, 0);
+        lv_style_set_border_width(&g_menu_item, 0);
+        lv_style_set_transition(&g_menu_item, &g_instant);
+
+        lv_style_init(&g_menu_item_divider);
+        lv_style_set_border_width(&g_menu_item_divider, 1);
+        lv_style_set_border_color(&g_menu_item_divider, lv_color_hex(0x333333));
+        lv_style_set_border_side(&g_menu_item_divider, LV_BORDER_SIDE_BOTTOM);
+
+        lv_style_init(&g_menu_item_selected);
+        lv_style_set_bg_color(&g_menu_item_selected, lv_color_hex(0x0088FF));
+        lv_style_set_transition(&g_menu_item_selected, &g_instant);
+
+        lv_style_init(&g_centered_text);
+        lv_style_set_text_align(&g_centered_text, LV_TEXT_ALIGN_CENTER);
+    }
+
+    void apply_screen_root(lv_obj_t *obj)
+    {
+        add(obj, &g_screen_root);
+    }
+
     void apply_title_bg(lv_obj_t *obj)
     {
         lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
-        lv_obj_set_size(obj, 280, 58);
-        lv_obj_set_style_bg_color(obj, lv_color_hex(0x333333), LV_PART_MAIN);
-        lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, LV_PART_MAIN);
-        lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN);
-        lv_obj_set_style_radius(obj, 0, LV_PART_MAIN);
+        add(obj, &g_title_bg);
     }
 
     void apply_title_text(lv_obj_t *obj)
     {
-        lv_obj_set_style_text_color(obj, lv_color_hex(0x9A9A9A), LV_PART_MAIN);
-        lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+        add(obj, &g_title_text);
     }
 
     void apply_big_number(lv_obj_t *obj)
     {
-        lv_obj_set_style_text_font(obj, &lv_font_montserrat_48, LV_PART_MAIN);
-        lv_obj_set_style_text_color(obj, lv_color_hex(0xFF00DC), LV_PART_MAIN);
-        lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+        add(obj, &g_big_number);
     }
 
     void apply_bottom_button(lv_obj_t *obj)
     {
-        lv_obj_set_size(obj, 240, 60);
-        lv_obj_set_style_bg_color(obj, lv_color_hex(0xDF7B0F), LV_PART_MAIN);
-        lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, LV_PART_MAIN);
-        lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN);
-        lv_obj_set_style_radius(obj, 0, LV_PART_MAIN);
-        lv_obj_set_style_outline_width(obj, 0, LV_PART_MAIN);
-        lv_obj_set_style_outline_width(obj, 0, LV_STATE_FOCUS_KEY);
-        lv_obj_set_style_outline_width(obj, 0, LV_STATE_FOCUSED);
+        add(obj, &g_bottom_button);
+        add(obj, &g_no_outline, LV_STATE_FOCUS_KEY);
+        add(obj, &g_no_outline, LV_STATE_FOCUSED);
     }
 
     void apply_bottom_button_label(lv_obj_t *obj)
     {
-        lv_obj_set_style_text_color(obj, lv_color_hex(0x000000), LV_PART_MAIN);
-        lv_obj_set_style_text_align(obj, LV_TEXT_ALIGN_CENTER, LV_PART_MAIN);
+        add(obj, &g_bottom_button_label);
     }
 
     void apply_info_button(lv_obj_t *obj)
     {
-        lv_obj_set_size(obj, 34, 34);
-        lv_obj_set_style_bg_color(obj, lv_color_hex(0x666666), LV_PART_MAIN);
-        lv_obj_set_style_radius(obj, 17, LV_PART_MAIN);
-        lv_obj_set_style_border_width(obj, 2, LV_PART_MAIN);
-        lv_obj_set_style_border_color(obj, lv_color_hex(0x999999), LV_PART_MAIN);
-        lv_obj_set_style_outline_width(obj, 0, LV_PART_MAIN);
-        lv_obj_set_style_outline_width(obj, 0, LV_STATE_FOCUS_KEY);
-        lv_obj_set_style_outline_width(obj, 0, LV_STATE_FOCUSED);
+        add(obj, &g_info_button);
+        add(obj, &g_no_outline, LV_STATE_FOCUS_KEY);
+        add(obj, &g_no_outline, LV_STATE_FOCUSED);
+    }
+
+    void apply_info_button_label(lv_obj_t *obj)
+    {
+        add(obj, &g_info_button_label);
     }
 
     void apply_overlay_bg(lv_obj_t *obj)
     {
-        lv_obj_set_size(obj, 240, 240);
-        lv_obj_set_style_bg_color(obj, lv_color_black(), LV_PART_MAIN);
-        lv_obj_set_style_bg_opa(obj, LV_OPA_90, LV_PART_MAIN);
-        lv_obj_set_style_border_width(obj, 0, LV_PART_MAIN);
-        lv_obj_set_style_pad_all(obj, 0, LV_PART_MAIN);
+        add(obj, &g_overlay_bg);
         lv_obj_clear_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
     }
+
+    void apply_option_name(lv_obj_t *obj)
+    {
+        add(obj, &g_option_name);
+    }
+
+    void apply_option_description(lv_obj_t *obj)
+    {
+        add(obj, &g_option_description);
+    }
+
+    void apply_hint_text(lv_obj_t *obj)
+    {
+        add(obj, &g_hint_text);
+    }
+
+    void apply_detail_text(lv_obj_t *obj)
+    {
+        add(obj, &g_detail_text);
+    }
+
+    void apply_status_text(lv_obj_t *obj)
+    {
+        add(obj, &g_status_text);
+    }
+
+    void apply_chip_line(lv_obj_t *obj, int index)
+    {
+        for (auto &style : g_chip_line)
+        {
+            lv_obj_remove_style(obj, &style, LV_PART_MAIN);
+        }
+        if (index >= 0 && index < chips::kDenominationCount)
+        {
+            add(obj, &g_chip_line[index]);
+        }
+    }
+
+    void apply_log_line(lv_obj_t *obj)
+    {
+        add(obj, &g_log_line);
+    }
+
+    void apply_blind_value(lv_obj_t *obj, Blind blind)
+    {
+        add(obj, &g_blind_value[blind == Blind::Big ? 1 : 0]);
+    }
+
+    void apply_blind_label(lv_obj_t *obj, Blind blind)
+    {
+        add(obj, &g_blind_label[blind == Blind::Big ? 1 : 0]);
+    }
+
+    void apply_timer_text(lv_obj_t *obj, lv_text_align_t align)
+    {
+        add(obj, &g_timer_text);
+        if (align == LV_TEXT_ALIGN_LEFT)
+        {
+            add(obj, &g_align_left);
+        }
+        else if (align == LV_TEXT_ALIGN_RIGHT)
+        {
+            add(obj, &g_align_right);
+        }
+    }
+
+    void apply_menu_item(lv_obj_t *obj, bool divider)
+    {
+        add(obj, &g_menu_item);
+        if (divider)
+        {
+            add(obj, &g_menu_item_divider);
+        }
+        add(obj, &g_menu_item_selected, LV_STATE_CHECKED);
+    }
+
+    void apply_centered_text(lv_obj_t *obj)
+    {
+        add(obj, &g_centered_text);
+    }
 }
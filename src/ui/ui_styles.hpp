@@ -2,8 +2,18 @@
 
 #include <lvgl.h>
 
+/// Shared widget styles.
+/// Every style is a static lv_style_t built once by init() and attached with
+/// lv_obj_add_style(), so widgets share one copy of each property list instead
+/// of each allocating its own local style on the LVGL heap.
 namespace ui::styles
 {
+    /// Build all shared styles (call once from ui_init(), before any screen is created)
+    void init();
+
+    /// Apply screen root container styling (full screen, transparent, unpadded)
+    void apply_screen_root(lv_obj_t *obj);
+
     /// Apply dark grey banner styling (used for page titles)
     void apply_title_bg(lv_obj_t *obj);
 
@@ -22,6 +32,55 @@ namespace ui::styles
     /// Apply info button styling (grey circle with "i")
     void apply_info_button(lv_obj_t *obj);
 
+    /// Apply info button label styling (white "i")
+    void apply_info_button_label(lv_obj_t *obj);
+
     /// Apply overlay background styling (90% opaque black, no scrolling)
     void apply_overlay_bg(lv_obj_t *obj);
+
+    /// Apply selected option styling (24pt purple, centered)
+    void apply_option_name(lv_obj_t *obj);
+
+    /// Apply option description styling (light grey, centered)
+    void apply_option_description(lv_obj_t *obj);
+
+    /// Apply hint text styling (dark grey, centered)
+    void apply_hint_text(lv_obj_t *obj);
+
+    /// Apply secondary text styling (pale grey, centered)
+    void apply_detail_text(lv_obj_t *obj);
+
+    /// Apply status text styling (white, centered)
+    void apply_status_text(lv_obj_t *obj);
+
+    /// Apply chip breakdown line styling (chip colour, centered; replaces an earlier chip colour)
+    /// @param index Denomination index into chips::kChipSet
+    void apply_chip_line(lv_obj_t *obj, int index);
+
+    /// Apply game log line styling (light grey, left aligned)
+    void apply_log_line(lv_obj_t *obj);
+
+    /// Blind shown on the game screen
+    enum class Blind
+    {
+        Small,
+        Big
+    };
+
+    /// Apply blind value styling (48pt, green for small / cyan for big, centered)
+    void apply_blind_value(lv_obj_t *obj, Blind blind);
+
+    /// Apply blind caption styling (green for small / cyan for big, centered)
+    void apply_blind_label(lv_obj_t *obj, Blind blind);
+
+    /// Apply countdown digit styling (48pt white)
+    /// @param align LV_TEXT_ALIGN_LEFT or LV_TEXT_ALIGN_RIGHT (anything else leaves it unset)
+    void apply_timer_text(lv_obj_t *obj, lv_text_align_t align);
+
+    /// Apply pause menu item styling (grey row, blue while LV_STATE_CHECKED)
+    /// @param divider Draw the bottom divider line (all rows but the last)
+    void apply_menu_item(lv_obj_t *obj, bool divider);
+
+    /// Apply centered text styling (used for menu item labels)
+    void apply_centered_text(lv_obj_t *obj);
 }
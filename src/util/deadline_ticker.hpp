@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstdint>
+
+namespace util {
+
+/// Fixed-rate tick counter driven by absolute deadlines.
+/// Tick N is due at start + N * period, independent of when take() runs,
+/// so a late caller gets the missed ticks back instead of shifting the
+/// phase. Time is passed in by the caller (no hardware dependency).
+class DeadlineTicker {
+public:
+    /// @param period_us Tick period in microseconds (must be positive)
+    explicit DeadlineTicker(int64_t period_us) : period_us_(period_us) {}
+
+    /// Restart the phase: the first tick is due one period after now_us
+    void start(int64_t now_us) { next_deadline_us_ = now_us + period_us_; }
+
+    /// Take the ticks whose deadlines have passed and advance the deadline
+    /// @param now_us Current time in microseconds
+    /// @return Number of ticks due (0 if the next deadline is in the future)
+    uint32_t take(int64_t now_us) {
+        if (now_us < next_deadline_us_) {
+            return 0;
+        }
+        int64_t due = (now_us - next_deadline_us_) / period_us_ + 1;
+        next_deadline_us_ += due * period_us_;
+        return static_cast<uint32_t>(due);
+    }
+
+    /// Absolute time of the next tick in microseconds
+    int64_t next_deadline_us() const { return next_deadline_us_; }
+
+    /// Tick period in microseconds
+    int64_t period_us() const { return period_us_; }
+
+private:
+    int64_t period_us_;
+    int64_t next_deadline_us_ = 0;
+};
+
+} // namespace util
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+namespace util {
+
+/// Fixed-capacity lock-free single-producer / single-consumer ring buffer.
+/// push() may only be called from one context (task, timer callback or ISR)
+/// and pop() from one other. No heap, no locks.
+/// @tparam T Trivially copyable element type
+/// @tparam N Capacity (must be a power of two)
+template <typename T, size_t N>
+class SpscQueue {
+    static_assert(N > 0 && (N & (N - 1)) == 0, "SpscQueue capacity must be a power of two");
+
+public:
+    /// Append an element (producer side)
+    /// @return false if the queue is full (element dropped)
+    bool push(const T& value) {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head - tail_.load(std::memory_order_acquire) >= N) {
+            return false;
+        }
+        buffer_[head & (N - 1)] = value;
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Remove the oldest element (consumer side)
+    /// @return false if the queue is empty
+    bool pop(T& out) {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail == head_.load(std::memory_order_acquire)) {
+            return false;
+        }
+        out = buffer_[tail & (N - 1)];
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// Check if the queue is empty (approximate when called from the producer)
+    bool empty() const {
+        return head_.load(std::memory_order_acquire) == tail_.load(std::memory_order_acquire);
+    }
+
+    /// Number of queued elements (approximate when racing the other side)
+    size_t size() const {
+        return head_.load(std::memory_order_acquire) - tail_.load(std::memory_order_acquire);
+    }
+
+    static constexpr size_t capacity() { return N; }
+
+private:
+    T buffer_[N] = {};
+    std::atomic<size_t> head_{0};  // Written by producer only
+    std::atomic<size_t> tail_{0};  // Written by consumer only
+};
+
+} // namespace util
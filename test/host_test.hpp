@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstdio>
+#include <cstdlib>
+
+/// Minimal host test support: each test is a plain executable run by ctest.
+/// CHECK/CHECK_EQ report a failure and keep going; main() returns host_test::result().
+namespace host_test {
+
+inline int& failures() {
+    static int count = 0;
+    return count;
+}
+
+inline void fail(const char* file, int line, const char* what) {
+    printf("%s:%d: check failed: %s\n", file, line, what);
+    failures()++;
+}
+
+/// Exit code for main(): 0 if every check passed
+inline int result() {
+    if (failures() > 0) {
+        printf("%d check(s) failed\n", failures());
+        return EXIT_FAILURE;
+    }
+    printf("all checks passed\n");
+    return EXIT_SUCCESS;
+}
+
+} // namespace host_test
+
+#define CHECK(cond)                                         \
+    do {                                                    \
+        if (!(cond)) {                                      \
+            host_test::fail(__FILE__, __LINE__, #cond);     \
+        }                                                   \
+    } while (0)
+
+#define CHECK_EQ(actual, expected)                                                      \
+    do {                                                                                \
+        long long actual_ = static_cast<long long>(actual);                             \
+        long long expected_ = static_cast<long long>(expected);                         \
+        if (actual_ != expected_) {                                                     \
+            printf("%s:%d: %s == %lld, expected %s == %lld\n", __FILE__, __LINE__,      \
+                   #actual, actual_, #expected, expected_);                             \
+            host_test::failures()++;                                                    \
+        }                                                                               \
+    } while (0)
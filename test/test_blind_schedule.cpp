@@ -0,0 +1,109 @@
+// blinds::kSchedules: the compile-time tables must match the round-by-round
+// float math that GameActiveScreen::advance_round() did at run time.
+
+#include "blind_schedule.hpp"
+#include "host_test.hpp"
+
+namespace {
+
+constexpr int kBaselineMaxBlind = 9999;
+
+/// GameActiveScreen::advance_round() before the tables (verbatim arithmetic):
+/// multiply, round to the nearest 25, raise by at least 25, cap at 9999
+int baseline_advance_round(int small_blind, float multiplier) {
+    int prev_small_blind = small_blind;
+    float new_sb = small_blind * multiplier;
+    int new_small_blind = static_cast<int>((new_sb + 12.5f) / 25) * 25;
+    if (new_small_blind <= prev_small_blind) {
+        new_small_blind = prev_small_blind + 25;
+    }
+    if (new_small_blind > kBaselineMaxBlind) {
+        new_small_blind = kBaselineMaxBlind;
+    }
+    return new_small_blind;
+}
+
+/// The same rule as a constexpr function, for the table generator
+constexpr int baseline_rule(int small_blind, float multiplier) {
+    float new_sb = small_blind * multiplier;
+    int new_small_blind = static_cast<int>((new_sb + 12.5f) / 25) * 25;
+    if (new_small_blind <= small_blind) {
+        new_small_blind = small_blind + 25;
+    }
+    return new_small_blind > kBaselineMaxBlind ? kBaselineMaxBlind : new_small_blind;
+}
+
+/// Generator output for the baseline rule, evaluated by the compiler
+constexpr blinds::ScheduleTable kBaselineTable = blinds::make_schedule_table(baseline_rule);
+
+// volatile keeps the compiler from folding the run-time walks into constants
+volatile float g_multipliers[blinds::kModeCount] = {blinds::kMultipliers[0], blinds::kMultipliers[1],
+                                                    blinds::kMultipliers[2]};
+
+/// Walk one game round by round the way advance_round() does, at run time,
+/// and compare every level with a table row
+template <typename Step>
+int compare_walk(const blinds::Schedule& table, int start_small_blind, int mode, Step step) {
+    int mismatches = 0;
+    int small_blind = start_small_blind;
+    for (int round = 1; round <= blinds::kLevels; round++) {
+        if (table[round - 1] != small_blind) {
+            printf("mode %d start %d round %d: table %d, run time %d\n", mode, start_small_blind, round,
+                   (int)table[round - 1], small_blind);
+            mismatches++;
+        }
+        small_blind = step(small_blind, g_multipliers[mode]);
+    }
+    return mismatches;
+}
+
+void test_generator_matches_baseline_loop() {
+    int mismatches = 0;
+    for (int mode = 0; mode < blinds::kModeCount; mode++) {
+        for (int start = 0; start < blinds::kStartCount; start++) {
+            int start_small_blind = blinds::kStartMin + start * blinds::kStartStep;
+            mismatches += compare_walk(kBaselineTable[mode][start], start_small_blind, mode,
+                                       baseline_advance_round);
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+}
+
+void test_schedules_match_run_time_rule() {
+    int mismatches = 0;
+    for (int mode = 0; mode < blinds::kModeCount; mode++) {
+        for (int start = 0; start < blinds::kStartCount; start++) {
+            int start_small_blind = blinds::kStartMin + start * blinds::kStartStep;
+            mismatches += compare_walk(blinds::kSchedules[mode][start], start_small_blind, mode,
+                                       [](int small_blind, float multiplier) {
+                                           return blinds::next_small_blind(small_blind, multiplier);
+                                       });
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+}
+
+void test_lookup() {
+    using blinds::Mode;
+    // Round 1 is the starting blind; rounds past the table stay at the cap
+    CHECK_EQ(blinds::small_blind_at(Mode::Standard, 50, 1), 50);
+    CHECK_EQ(blinds::small_blind_at(Mode::Standard, 50, 0), 50);
+    CHECK_EQ(blinds::small_blind_at(Mode::Turbo, 25, blinds::kLevels + 5), blinds::kCapBlind);
+    CHECK_EQ(blinds::small_blind_at(Mode::Relaxed, 100, 4), blinds::kSchedules[2][3][3]);
+
+    // A start the UI never offers walks the same rule
+    int small_blind = 30;
+    for (int round = 2; round <= 6; round++) {
+        small_blind = blinds::next_small_blind(small_blind, blinds::kMultipliers[0]);
+    }
+    CHECK_EQ(blinds::small_blind_at(Mode::Standard, 30, 6), small_blind);
+}
+
+} // namespace
+
+int main() {
+    test_generator_matches_baseline_loop();
+    test_schedules_match_run_time_rule();
+    test_lookup();
+    return host_test::result();
+}
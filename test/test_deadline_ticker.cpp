@@ -0,0 +1,91 @@
+// util::DeadlineTicker: 4 hours of jittery main-loop wakeups must count
+// exactly elapsed / period ticks, with no drift at any point.
+
+#include <cstdint>
+#include <random>
+#include "host_test.hpp"
+#include "util/deadline_ticker.hpp"
+
+namespace {
+
+constexpr int64_t kFourHoursUs = 4LL * 60 * 60 * 1000000;
+
+/// Drive a ticker the way the scheduler does: sleep until the next deadline,
+/// wake late by a random jitter, sometimes early (other events), sometimes stall.
+/// Checks the tick count against the wall clock after every wakeup.
+void run_jittered(int64_t period_us, int64_t start_us, uint32_t seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int64_t> jitter_us(0, 20000);       // Late wakeup, up to 20 ms
+    std::uniform_int_distribution<int64_t> early_us(1, period_us);    // Event wakeup before the deadline
+    std::uniform_int_distribution<int64_t> stall_us(period_us, 15000000);  // Blocked up to 15 s
+    std::uniform_int_distribution<int> pick(0, 99);
+
+    util::DeadlineTicker ticker(period_us);
+    ticker.start(start_us);
+
+    int64_t now = start_us;
+    uint64_t ticks = 0;
+    uint64_t drift_errors = 0;
+    int stalls = 0;
+    while (now - start_us < kFourHoursUs) {
+        int kind = pick(rng);
+        if (kind < 2) {
+            now += stall_us(rng);  // Flash write, long LVGL redraw, debugger...
+            stalls++;
+        } else if (kind < 30) {
+            now += early_us(rng) / 2;  // Woken by input or another timer
+        } else {
+            now = ticker.next_deadline_us() + jitter_us(rng);
+        }
+
+        ticks += ticker.take(now);
+        if (ticks != static_cast<uint64_t>((now - start_us) / period_us)) {
+            drift_errors++;
+        }
+        // Deadlines stay on the original phase
+        if ((ticker.next_deadline_us() - start_us) % period_us != 0) {
+            drift_errors++;
+        }
+    }
+
+    CHECK_EQ(drift_errors, 0);
+    CHECK_EQ(ticks, (now - start_us) / period_us);
+    CHECK(stalls > 0);
+    printf("period %lld us: %llu ticks over %lld s (%d stalls)\n", (long long)period_us,
+           (unsigned long long)ticks, (long long)((now - start_us) / 1000000), stalls);
+}
+
+void test_no_drift_with_jitter() {
+    run_jittered(1000000, 0, 1);           // Game clock (1 s)
+    run_jittered(1000000, 123456789, 2);   // Arbitrary boot time
+    run_jittered(100000, 5000, 3);         // Faster ticker
+    run_jittered(333333, 42, 4);           // Period that does not divide a second
+}
+
+void test_take_semantics() {
+    util::DeadlineTicker ticker(1000);
+    ticker.start(500);
+    CHECK_EQ(ticker.take(1499), 0);   // Just before the first deadline
+    CHECK_EQ(ticker.take(1500), 1);   // Exactly on it
+    CHECK_EQ(ticker.take(1500), 0);   // Not counted twice
+    CHECK_EQ(ticker.take(5499), 3);   // Missed ticks come back at once
+    CHECK_EQ(ticker.next_deadline_us(), 5500);
+}
+
+void test_restart_resets_phase() {
+    util::DeadlineTicker ticker(1000);
+    ticker.start(0);
+    CHECK_EQ(ticker.take(2500), 2);
+    ticker.start(10000);  // E.g. resume after a pause
+    CHECK_EQ(ticker.take(10999), 0);
+    CHECK_EQ(ticker.take(11000), 1);
+}
+
+} // namespace
+
+int main() {
+    test_take_semantics();
+    test_restart_resets_phase();
+    test_no_drift_with_jitter();
+    return host_test::result();
+}
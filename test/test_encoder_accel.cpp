@@ -0,0 +1,155 @@
+// EncoderAccel: replay slow, medium and flick rotation traces against each
+// value-entry screen's AccelCurve and check the steps it produces.
+
+#include <cstdint>
+#include <cstdlib>
+#include <random>
+#include <vector>
+#include "host_test.hpp"
+#include "input/encoder_accel.hpp"
+
+namespace {
+
+using encoder_input::AccelCurve;
+using encoder_input::EncoderAccel;
+
+struct ScreenCurve {
+    const char* screen;
+    AccelCurve curve;
+};
+
+constexpr ScreenCurve kScreens[] = {
+    {"SmallBlindScreen", encoder_input::kDefaultAccelCurve},
+    {"RoundMinutesScreen", encoder_input::kDefaultAccelCurve},
+    {"VolumeScreen", encoder_input::kVolumeAccelCurve},
+};
+
+/// One encoder event: detents reported and time since the previous event
+struct Event {
+    int diff;
+    int64_t dt_us;
+};
+
+/// Events of a turn at a given pace, with per-event timing jitter;
+/// fast turns report several detents per event like the real input task does
+std::vector<Event> make_trace(std::mt19937& rng, int events, int direction, int64_t min_dt_us, int64_t max_dt_us,
+                              int max_detents = 1) {
+    std::uniform_int_distribution<int64_t> dt(min_dt_us, max_dt_us);
+    std::uniform_int_distribution<int> detents(1, max_detents);
+    std::vector<Event> trace;
+    for (int i = 0; i < events; i++) {
+        trace.push_back({direction * detents(rng), dt(rng)});
+    }
+    return trace;
+}
+
+/// Steps per detent for every event of a trace (fresh accelerator, as on screen entry)
+struct Replay {
+    std::vector<float> steps_per_detent;
+    int total_detents = 0;
+    int total_steps = 0;
+    int sign_errors = 0;
+};
+
+Replay replay(const AccelCurve& curve, const std::vector<Event>& trace, int64_t start_us = 1000000) {
+    EncoderAccel accel(curve);
+    Replay result;
+    int64_t now = start_us;
+    for (const Event& event : trace) {
+        now += event.dt_us;
+        int steps = accel.apply(event.diff, now);
+        if ((steps > 0) != (event.diff > 0)) {
+            result.sign_errors++;
+        }
+        result.steps_per_detent.push_back(static_cast<float>(std::abs(steps)) / std::abs(event.diff));
+        result.total_detents += std::abs(event.diff);
+        result.total_steps += std::abs(steps);
+    }
+    return result;
+}
+
+void test_slow_turns_are_one_step_per_detent() {
+    std::mt19937 rng(11);
+    for (const auto& screen : kScreens) {
+        for (int direction : {1, -1}) {
+            // 1.7-5.5 detents per second: reading the value while turning
+            Replay r = replay(screen.curve, make_trace(rng, 40, direction, 180000, 600000));
+            CHECK_EQ(r.sign_errors, 0);
+            CHECK_EQ(r.total_steps, r.total_detents);
+            if (r.total_steps != r.total_detents) {
+                printf("  %s slow turn\n", screen.screen);
+            }
+        }
+    }
+}
+
+void test_medium_turns_speed_up_a_little() {
+    std::mt19937 rng(12);
+    for (const auto& screen : kScreens) {
+        // 9-14 detents per second
+        Replay r = replay(screen.curve, make_trace(rng, 40, 1, 70000, 110000));
+        CHECK_EQ(r.sign_errors, 0);
+        // Faster than one step per detent, far from a flick
+        CHECK(r.total_steps > r.total_detents);
+        CHECK(r.total_steps <= 2 * r.total_detents);
+    }
+}
+
+void test_flick_reaches_max_multiplier() {
+    std::mt19937 rng(13);
+    for (const auto& screen : kScreens) {
+        for (int direction : {1, -1}) {
+            // 40-130 detents per second, 1-2 detents per event
+            Replay r = replay(screen.curve, make_trace(rng, 30, direction, 15000, 25000, 2));
+            CHECK_EQ(r.sign_errors, 0);
+            // Starts precise, then saturates
+            CHECK(r.steps_per_detent.front() == 1.0f);
+            float last = r.steps_per_detent.back();
+            CHECK(last >= screen.curve.max_multiplier - 0.5f && last <= screen.curve.max_multiplier + 0.5f);
+            CHECK(r.total_steps >= 0.8f * screen.curve.max_multiplier * r.total_detents);
+            CHECK(r.total_steps <= screen.curve.max_multiplier * r.total_detents);
+        }
+    }
+}
+
+void test_volume_cap() {
+    std::mt19937 rng(14);
+    const AccelCurve& curve = encoder_input::kVolumeAccelCurve;
+    // Even an impossible spin (one event every millisecond) stays at 2x
+    for (int64_t min_dt : {1000, 15000, 70000, 180000}) {
+        Replay r = replay(curve, make_trace(rng, 50, 1, min_dt, min_dt * 2, 3));
+        for (float steps : r.steps_per_detent) {
+            CHECK(steps <= 2.0f);
+        }
+        CHECK(r.total_steps <= 2 * r.total_detents);
+    }
+}
+
+void test_pause_and_reversal_restart_precise() {
+    EncoderAccel accel(encoder_input::kDefaultAccelCurve);
+    int64_t now = 0;
+    for (int i = 0; i < 20; i++) {
+        now += 20000;
+        accel.apply(1, now);
+    }
+    CHECK(accel.apply(1, now + 20000) > 1);  // Flicking
+    now += 20000;
+    CHECK_EQ(accel.apply(-1, now + 20000), -1);  // Reversal is precise
+    now += 20000;
+    for (int i = 0; i < 20; i++) {
+        now += 20000;
+        accel.apply(-1, now);
+    }
+    CHECK_EQ(accel.apply(-1, now + 300000), -1);  // So is a pause longer than 250 ms
+}
+
+} // namespace
+
+int main() {
+    test_slow_turns_are_one_step_per_detent();
+    test_medium_turns_speed_up_a_little();
+    test_flick_reaches_max_multiplier();
+    test_volume_cap();
+    test_pause_and_reversal_restart_precise();
+    return host_test::result();
+}
@@ -0,0 +1,156 @@
+// EncoderCount: edge bursts through a simulated PCNT unit must come back as
+// deltas that add up to exactly the edges injected, past the 16-bit limits in
+// both directions, across int32 wrap, and with limit events arriving late.
+
+#include <climits>
+#include <cstdint>
+#include <random>
+#include <vector>
+#include "encoder_count.hpp"
+#include "host_test.hpp"
+
+namespace {
+
+constexpr int kLowLimit = -32768;
+constexpr int kHighLimit = 32767;
+constexpr int kMaxEdgesPerRead = kHighLimit / 2 - 1;  // EncoderCount's assumption
+
+/// PCNT unit model: the count returns to 0 at either limit and raises that
+/// limit's watch-point event, which runs at once or is held back like an ISR
+/// waiting for a critical section to end
+struct FakePcnt {
+    EncoderCount count{kLowLimit, kHighLimit};
+    int hw = 0;
+    bool defer_events = false;
+    std::vector<int> pending;
+
+    void edges(int n) {
+        int step = n > 0 ? 1 : -1;
+        for (int i = 0; i != n; i += step) {
+            hw += step;
+            if (hw == kHighLimit || hw == kLowLimit) {
+                int limit = hw;
+                hw = 0;
+                if (defer_events) {
+                    pending.push_back(limit);
+                } else {
+                    count.onLimit(limit);
+                }
+            }
+        }
+    }
+
+    void run_events() {
+        for (int limit : pending) {
+            count.onLimit(limit);
+        }
+        pending.clear();
+    }
+};
+
+/// Reader side: Encoder::getDelta() on the simulated unit
+struct Reader {
+    FakePcnt& pcnt;
+    int32_t last;
+    int64_t delta_sum = 0;
+    int64_t edge_sum = 0;
+    int64_t edges_since_read = 0;
+    int bad_deltas = 0;
+
+    explicit Reader(FakePcnt& unit) : pcnt(unit), last(unit.count.position(unit.hw)) {}
+
+    void inject(int n) {
+        pcnt.edges(n);
+        edges_since_read += n;
+        edge_sum += n;
+    }
+
+    void read() {
+        int32_t delta = EncoderCount::delta(pcnt.count.position(pcnt.hw), last);
+        if (delta != edges_since_read) {
+            printf("delta %ld, expected %lld\n", (long)delta, (long long)edges_since_read);
+            bad_deltas++;
+        }
+        delta_sum += delta;
+        edges_since_read = 0;
+    }
+};
+
+void test_random_bursts() {
+    std::mt19937 rng(5);
+    std::uniform_int_distribution<int> burst(-kMaxEdgesPerRead, kMaxEdgesPerRead);
+    FakePcnt pcnt;
+    Reader reader(pcnt);
+    for (int i = 0; i < 20000; i++) {
+        reader.inject(burst(rng));
+        reader.read();
+    }
+    CHECK_EQ(reader.bad_deltas, 0);
+    CHECK_EQ(reader.delta_sum, reader.edge_sum);
+}
+
+void test_spin_past_limits_both_ways() {
+    FakePcnt pcnt;
+    Reader reader(pcnt);
+    // Ten full turns of the 16-bit counter up, then twenty down
+    for (int i = 0; i < 10 * kHighLimit / 1000; i++) {
+        reader.inject(1000);
+        reader.read();
+    }
+    for (int i = 0; i < 20 * kHighLimit / 1000; i++) {
+        reader.inject(-1000);
+        reader.read();
+    }
+    CHECK_EQ(reader.bad_deltas, 0);
+    CHECK_EQ(reader.delta_sum, reader.edge_sum);
+    CHECK_EQ(pcnt.count.position(pcnt.hw), reader.edge_sum);
+}
+
+void test_late_limit_events() {
+    std::mt19937 rng(9);
+    std::uniform_int_distribution<int> burst(-kMaxEdgesPerRead, kMaxEdgesPerRead);
+    std::uniform_int_distribution<int> coin(0, 1);
+    FakePcnt pcnt;
+    pcnt.defer_events = true;
+    Reader reader(pcnt);
+    int reads_with_pending = 0;
+    for (int i = 0; i < 20000; i++) {
+        reader.inject(burst(rng));
+        // Read before or after the event handler gets to run
+        if (coin(rng)) {
+            reads_with_pending += pcnt.pending.empty() ? 0 : 1;
+            reader.read();
+            pcnt.run_events();
+        } else {
+            pcnt.run_events();
+            reader.read();
+        }
+    }
+    CHECK(reads_with_pending > 0);
+    CHECK_EQ(reader.bad_deltas, 0);
+    CHECK_EQ(reader.delta_sum, reader.edge_sum);
+}
+
+void test_int32_wrap() {
+    for (int direction : {1, -1}) {
+        FakePcnt pcnt;
+        pcnt.count.reset(direction > 0 ? INT32_MAX - 50000 : INT32_MIN + 50000);
+        Reader reader(pcnt);
+        for (int i = 0; i < 100; i++) {
+            reader.inject(direction * 1000);
+            reader.read();
+        }
+        CHECK_EQ(reader.bad_deltas, 0);
+        CHECK_EQ(reader.delta_sum, direction * 100000);
+    }
+}
+
+} // namespace
+
+int main() {
+    test_random_bursts();
+    test_spin_past_limits_both_ways();
+    test_late_limit_events();
+    test_int32_wrap();
+    return host_test::result();
+}
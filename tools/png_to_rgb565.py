@@ -0,0 +1,148 @@
+#!/usr/bin/env python3
+"""Convert a PNG into a run-length encoded RGB565 image for the display.
+
+Output layout (all multi-byte header fields little-endian):
+
+    uint16 width
+    uint16 height
+    packets...
+
+Each packet starts with a control byte:
+
+    0x00-0x7F  literal: (n + 1) pixels follow
+    0x80-0xFF  repeat:  the next pixel is repeated (n - 0x80 + 2) times
+
+Pixels are RGB565 stored big-endian, the byte order the GC9A01 expects, so
+the firmware can push them without converting. Transparent pixels are
+composited over black. Only the Python standard library is used so the
+conversion runs inside the ESP-IDF build environment.
+
+Usage: png_to_rgb565.py input.png output.bin
+"""
+
+import struct
+import sys
+import zlib
+
+PNG_SIGNATURE = b"\x89PNG\r\n\x1a\n"
+
+# Channels per pixel for each PNG colour type we accept (8-bit depth only)
+CHANNELS = {0: 1, 2: 3, 4: 2, 6: 4}
+
+MAX_LITERAL = 128
+MAX_REPEAT = 129
+
+
+def read_png(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if not data.startswith(PNG_SIGNATURE):
+        raise ValueError(f"{path}: not a PNG file")
+
+    pos = len(PNG_SIGNATURE)
+    idat = bytearray()
+    header = None
+    while pos < len(data):
+        length, kind = struct.unpack(">I4s", data[pos:pos + 8])
+        body = data[pos + 8:pos + 8 + length]
+        pos += 12 + length
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", body)
+        elif kind == b"IDAT":
+            idat += body
+        elif kind == b"IEND":
+            break
+
+    if header is None:
+        raise ValueError(f"{path}: missing IHDR")
+    width, height, depth, colour, _, _, interlace = header
+    if depth != 8 or colour not in CHANNELS or interlace != 0:
+        raise ValueError(f"{path}: only 8-bit, non-interlaced grey/RGB(A) PNGs are supported")
+
+    bpp = CHANNELS[colour]
+    stride = width * bpp
+    raw = zlib.decompress(bytes(idat))
+    rows = []
+    prev = bytearray(stride)
+    for y in range(height):
+        offset = y * (stride + 1)
+        kind = raw[offset]
+        line = bytearray(raw[offset + 1:offset + 1 + stride])
+        for i in range(stride):
+            a = line[i - bpp] if i >= bpp else 0
+            b = prev[i]
+            c = prev[i - bpp] if i >= bpp else 0
+            if kind == 1:
+                line[i] = (line[i] + a) & 0xFF
+            elif kind == 2:
+                line[i] = (line[i] + b) & 0xFF
+            elif kind == 3:
+                line[i] = (line[i] + ((a + b) >> 1)) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                pred = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                line[i] = (line[i] + pred) & 0xFF
+        rows.append(line)
+        prev = line
+
+    pixels = []
+    for line in rows:
+        for x in range(width):
+            px = line[x * bpp:(x + 1) * bpp]
+            if colour == 0:
+                r = g = b = px[0]
+                alpha = 255
+            elif colour == 4:
+                r = g = b = px[0]
+                alpha = px[1]
+            else:
+                r, g, b = px[0], px[1], px[2]
+                alpha = px[3] if colour == 6 else 255
+            r, g, b = (r * alpha + 127) // 255, (g * alpha + 127) // 255, (b * alpha + 127) // 255
+            pixels.append(((r & 0xF8) << 8) | ((g & 0xFC) << 3) | (b >> 3))
+    return width, height, pixels
+
+
+def encode_rle(pixels):
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:MAX_LITERAL]
+            del literal[:MAX_LITERAL]
+            out.append(len(chunk) - 1)
+            for p in chunk:
+                out.extend(struct.pack(">H", p))
+
+    i = 0
+    n = len(pixels)
+    while i < n:
+        run = 1
+        while i + run < n and run < MAX_REPEAT and pixels[i + run] == pixels[i]:
+            run += 1
+        if run >= 2:
+            flush_literal()
+            out.append(0x80 + run - 2)
+            out += struct.pack(">H", pixels[i])
+        else:
+            literal.append(pixels[i])
+        i += run
+    flush_literal()
+    return bytes(out)
+
+
+def main(argv):
+    if len(argv) != 3:
+        sys.stderr.write(__doc__)
+        return 2
+    width, height, pixels = read_png(argv[1])
+    encoded = struct.pack("<HH", width, height) + encode_rle(pixels)
+    with open(argv[2], "wb") as f:
+        f.write(encoded)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))
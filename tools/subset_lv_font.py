@@ -0,0 +1,426 @@
+#!/usr/bin/env python3
+"""Cut an LVGL font source file down to the glyphs the firmware draws.
+
+Reads a font generated by lv_font_conv in LVGL's C format (the bundled
+lv_font_montserrat_*.c files) and writes a copy containing only the requested
+characters: bitmaps, glyph descriptors, character maps and kerning classes are
+rebuilt for the subset, everything else (metrics, version conditionals) is
+kept as is, and the public font is renamed.
+
+Options:
+
+    --bpp 3|4      output bits per pixel (3 only together with --compress)
+    --compress     RLE-compress the bitmaps in LVGL's format (line XOR
+                   prefilter + RLE; needs LV_USE_FONT_COMPRESSED)
+    --fallback F   font drawn for characters outside the subset
+
+Every compressed glyph is decoded again and compared before the file is
+written, so a bad encoding fails the build instead of drawing garbage.
+A size summary is printed to stdout. Only the Python standard library is
+used so the conversion runs inside the ESP-IDF build environment.
+
+Usage: subset_lv_font.py [options] input.c symbol chars output.c
+"""
+
+import argparse
+import re
+import sys
+
+COMMENT = re.compile(r"/\*.*?\*/", re.S)
+FIELD = re.compile(r"\.(\w+)\s*=\s*([^,\s}]+)")
+
+
+def find_array(text, name):
+    """Match of `name[] = { ... };` (group 1 is the body)."""
+    m = re.search(r"\b%s\[\]\s*=\s*\{(.*?)\};" % re.escape(name), text, re.S)
+    if m is None:
+        raise ValueError(f"array {name}[] not found")
+    return m
+
+
+def parse_ints(body):
+    return [int(v, 0) for v in COMMENT.sub("", body).replace("\n", " ").split(",") if v.strip()]
+
+
+def parse_structs(body):
+    """List of {field: value} dicts for each `{ .a = x, ... }` in body."""
+    return [dict(FIELD.findall(item)) for item in re.findall(r"\{([^{}]*)\}", COMMENT.sub("", body))]
+
+
+def font_field(text, name):
+    m = re.search(r"\.%s\s*=\s*([^,\s]+)," % name, text)
+    return m.group(1) if m else None
+
+
+def read_values(data, offset, count, bpp):
+    """Unpack count pixels of bpp bits, MSB first, starting at byte offset."""
+    values = []
+    bit = offset * 8
+    for _ in range(count):
+        byte = data[bit >> 3]
+        shift = 8 - (bit & 7) - bpp
+        values.append((byte >> shift) & ((1 << bpp) - 1))
+        bit += bpp
+    return values
+
+
+class BitWriter:
+    def __init__(self):
+        self.out = bytearray()
+        self.acc = 0
+        self.nbits = 0
+
+    def write(self, value, bits):
+        for i in range(bits - 1, -1, -1):
+            self.acc = (self.acc << 1) | ((value >> i) & 1)
+            self.nbits += 1
+            if self.nbits == 8:
+                self.out.append(self.acc)
+                self.acc = 0
+                self.nbits = 0
+
+    def finish(self):
+        if self.nbits:
+            self.out.append(self.acc << (8 - self.nbits))
+            self.acc = 0
+            self.nbits = 0
+        return bytes(self.out)
+
+
+def pack_plain(values, bpp):
+    w = BitWriter()
+    for v in values:
+        w.write(v, bpp)
+    return w.finish()
+
+
+# RLE states, mirroring rle_next() in LVGL's lv_font_fmt_txt.c
+SINGLE, REPEAT, COUNTER = range(3)
+
+
+def prefilter(values, width):
+    """XOR every row with the row above (what the decoder undoes)."""
+    out = list(values[:width])
+    for i in range(width, len(values)):
+        out.append(values[i] ^ values[i - width])
+    return out
+
+
+def rle_encode(values, bpp):
+    w = BitWriter()
+    state = SINGLE
+    prev = 0
+    first = True
+    count = 0
+    i = 0
+    n = len(values)
+    while i < n:
+        v = values[i]
+        if state == SINGLE:
+            w.write(v, bpp)
+            if not first and v == prev:
+                state = REPEAT
+                count = 0
+            first = False
+            prev = v
+            i += 1
+        elif v == prev:
+            # REPEAT: one '1' bit per repeat; the 11th is followed by a 6-bit
+            # counter C: C - 1 more repeats, then a literal
+            w.write(1, 1)
+            i += 1
+            count += 1
+            if count == 11:
+                more = 0
+                while i + more < n and values[i + more] == prev and more < 62:
+                    more += 1
+                w.write(more + 1, 6)
+                i += more
+                if i < n:
+                    prev = values[i]
+                    w.write(prev, bpp)
+                    i += 1
+                state = SINGLE
+        else:
+            w.write(0, 1)
+            w.write(v, bpp)
+            prev = v
+            i += 1
+            state = SINGLE
+    return w.finish()
+
+
+def rle_decode(data, bpp, count):
+    """Python port of LVGL's rle_next() loop, used to verify rle_encode()."""
+
+    def bits(pos, length):
+        value = 0
+        for k in range(length):
+            p = pos + k
+            byte = data[p >> 3] if (p >> 3) < len(data) else 0
+            value = (value << 1) | ((byte >> (7 - (p & 7))) & 1)
+        return value
+
+    out = []
+    state = SINGLE
+    rdp = 0
+    prev = 0
+    cnt = 0
+    for _ in range(count):
+        if state == SINGLE:
+            ret = bits(rdp, bpp)
+            if rdp != 0 and prev == ret:
+                cnt = 0
+                state = REPEAT
+            prev = ret
+            rdp += bpp
+        elif state == REPEAT:
+            v = bits(rdp, 1)
+            cnt += 1
+            rdp += 1
+            if v == 1:
+                ret = prev
+                if cnt == 11:
+                    cnt = bits(rdp, 6)
+                    rdp += 6
+                    if cnt != 0:
+                        state = COUNTER
+                    else:
+                        ret = bits(rdp, bpp)
+                        prev = ret
+                        rdp += bpp
+                        state = SINGLE
+            else:
+                ret = bits(rdp, bpp)
+                prev = ret
+                rdp += bpp
+                state = SINGLE
+        else:
+            ret = prev
+            cnt -= 1
+            if cnt == 0:
+                ret = bits(rdp, bpp)
+                prev = ret
+                rdp += bpp
+                state = SINGLE
+        out.append(ret)
+    return out
+
+
+def unprefilter(values, width):
+    out = list(values[:width])
+    for i in range(width, len(values)):
+        out.append(values[i] ^ out[i - width])
+    return out
+
+
+def glyph_map(text, cmaps):
+    """{codepoint: glyph id} from the character maps."""
+    mapping = {}
+    for cmap in cmaps:
+        start = int(cmap["range_start"], 0)
+        length = int(cmap["range_length"], 0)
+        gid_start = int(cmap["glyph_id_start"], 0)
+        kind = cmap["type"]
+        unicode = cmap.get("unicode_list", "NULL")
+        offsets = cmap.get("glyph_id_ofs_list", "NULL")
+        ulist = parse_ints(find_array(text, unicode).group(1)) if unicode != "NULL" else None
+        olist = parse_ints(find_array(text, offsets).group(1)) if offsets != "NULL" else None
+        if kind.endswith("FORMAT0_TINY"):
+            for i in range(length):
+                mapping[start + i] = gid_start + i
+        elif kind.endswith("FORMAT0_FULL"):
+            for i in range(length):
+                if i == 0 or olist[i]:
+                    mapping[start + i] = gid_start + olist[i]
+        elif kind.endswith("SPARSE_TINY"):
+            for i, ofs in enumerate(ulist):
+                mapping[start + ofs] = gid_start + i
+        elif kind.endswith("SPARSE_FULL"):
+            for i, ofs in enumerate(ulist):
+                mapping[start + ofs] = gid_start + olist[i]
+        else:
+            raise ValueError(f"unknown cmap type {kind}")
+    return mapping
+
+
+def format_bytes(data, indent="    ", per_line=16):
+    lines = []
+    for i in range(0, len(data), per_line):
+        lines.append(indent + ", ".join(f"0x{b:02x}" for b in data[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def format_ints(values, indent="    ", per_line=20):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(str(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def char_comment(cp):
+    ch = chr(cp)
+    if ch in "\\\"" or not ch.isprintable():
+        ch = "?"
+    return f'/* U+{cp:04X} "{ch}" */'
+
+
+def replace_body(text, name, body):
+    m = find_array(text, name)
+    return text[:m.start(1)] + "\n" + body + "\n" + text[m.end(1):]
+
+
+def drop_kerning(text):
+    text = re.sub(r"\n/\*[^\n]*\*/\nstatic const u?int8_t kern_\w+\[\]\s*=\s*\{.*?\};\n", "\n", text, flags=re.S)
+    text = re.sub(r"\n/\*[^\n]*\*/\nstatic const lv_font_fmt_txt_kern_classes_t kern_classes = \{.*?\};\n", "\n",
+                  text, flags=re.S)
+    text = re.sub(r"\.kern_dsc = [^,]+,", ".kern_dsc = NULL,", text)
+    return re.sub(r"\.kern_classes = \d+,", ".kern_classes = 0,", text)
+
+
+def subset(text, symbol, chars, out_bpp, compress, fallback):
+    in_bpp = int(font_field(text, "bpp"))
+    if font_field(text, "bitmap_format") not in ("0", "LV_FONT_FMT_TXT_PLAIN"):
+        raise ValueError("input font is already compressed")
+    if font_field(text, "stride") not in (None, "0"):
+        raise ValueError("input font uses aligned bitmaps (stride)")
+    if in_bpp != 4 and out_bpp != in_bpp:
+        raise ValueError("bpp conversion is only supported from 4 bpp")
+
+    bitmap_m = find_array(text, "glyph_bitmap")
+    bitmap = bytes(parse_ints(bitmap_m.group(1)))
+    glyphs = parse_structs(find_array(text, "glyph_dsc").group(1))
+    cmaps = parse_structs(find_array(text, "cmaps").group(1))
+    mapping = glyph_map(text, cmaps)
+
+    codepoints = sorted({ord(c) for c in chars})
+    missing = [chr(cp) for cp in codepoints if cp not in mapping]
+    if missing:
+        raise ValueError("characters not in the font: " + "".join(missing))
+
+    # Bitmaps
+    new_bitmap = bytearray()
+    new_glyphs = ["    {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */"]
+    bitmap_lines = []
+    for cp in codepoints:
+        g = glyphs[mapping[cp]]
+        w = int(g["box_w"])
+        h = int(g["box_h"])
+        values = read_values(bitmap, int(g["bitmap_index"]), w * h, in_bpp)
+        if out_bpp != in_bpp:
+            values = [(v * (2 * ((1 << out_bpp) - 1)) + 15) // 30 for v in values]
+        if compress and values:
+            filtered = prefilter(values, w)
+            data = rle_encode(filtered, out_bpp)
+            if unprefilter(rle_decode(data, out_bpp, len(values)), w) != values:
+                raise AssertionError(f"RLE round trip failed for U+{cp:04X}")
+        else:
+            data = pack_plain(values, out_bpp)
+        new_glyphs.append("    {.bitmap_index = %d, .adv_w = %s, .box_w = %d, .box_h = %d, .ofs_x = %s, .ofs_y = %s}"
+                          % (len(new_bitmap), g["adv_w"], w, h, g["ofs_x"], g["ofs_y"]))
+        bitmap_lines.append("    " + char_comment(cp))
+        if data:
+            bitmap_lines.append(format_bytes(data))
+        bitmap_lines.append("")
+        new_bitmap += data
+    # The decoder may read one byte past a glyph's last bit
+    if compress:
+        bitmap_lines.append("    0x00")
+    text = replace_body(text, "glyph_bitmap", "\n".join(bitmap_lines).rstrip())
+    text = replace_body(text, "glyph_dsc", ",\n".join(new_glyphs))
+
+    # Character maps: one FORMAT0_TINY map per run of consecutive codepoints
+    runs = []
+    for cp in codepoints:
+        if runs and cp == runs[-1][0] + runs[-1][1]:
+            runs[-1][1] += 1
+        else:
+            runs.append([cp, 1])
+    cmap_items = []
+    gid = 1
+    for start, length in runs:
+        cmap_items.append("    {\n"
+                          f"        .range_start = {start}, .range_length = {length}, .glyph_id_start = {gid},\n"
+                          "        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, "
+                          ".type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY\n"
+                          "    }")
+        gid += length
+    text = re.sub(r"\nstatic const uint(?:8|16)_t (?:unicode_list|glyph_id_ofs_list)_\d+\[\]\s*=\s*\{.*?\};\n", "\n",
+                  text, flags=re.S)
+    text = replace_body(text, "cmaps", ",\n".join(cmap_items))
+    text = re.sub(r"\.cmap_num = \d+,", f".cmap_num = {len(runs)},", text)
+
+    # Kerning classes: keep the classes the subset still uses, renumbered
+    if font_field(text, "kern_classes") == "1":
+        left = parse_ints(find_array(text, "kern_left_class_mapping").group(1))
+        right = parse_ints(find_array(text, "kern_right_class_mapping").group(1))
+        values = parse_ints(find_array(text, "kern_class_values").group(1))
+        right_cnt = int(font_field(text, "right_class_cnt"))
+        kept = [mapping[cp] for cp in codepoints]
+        left_used = sorted({left[g] for g in kept} - {0})
+        right_used = sorted({right[g] for g in kept} - {0})
+        pairs = [values[(l - 1) * right_cnt + (r - 1)] for l in left_used for r in right_used]
+        if any(pairs):
+            lmap = {c: i + 1 for i, c in enumerate(left_used)}
+            rmap = {c: i + 1 for i, c in enumerate(right_used)}
+            text = replace_body(text, "kern_left_class_mapping",
+                                format_ints([0] + [lmap.get(left[g], 0) for g in kept]))
+            text = replace_body(text, "kern_right_class_mapping",
+                                format_ints([0] + [rmap.get(right[g], 0) for g in kept]))
+            text = replace_body(text, "kern_class_values", format_ints(pairs))
+            text = re.sub(r"\.left_class_cnt\s*=\s*\d+", f".left_class_cnt      = {len(left_used)}", text)
+            text = re.sub(r"\.right_class_cnt\s*=\s*\d+", f".right_class_cnt     = {len(right_used)}", text)
+        else:
+            text = drop_kerning(text)
+    elif font_field(text, "kern_dsc") not in (None, "NULL"):
+        raise ValueError("only class-based kerning (--force-fast-kern-format) is supported")
+
+    # Font descriptor
+    text = re.sub(r"\.bpp = \d+,", f".bpp = {out_bpp},", text)
+    text = re.sub(r"\.bitmap_format = \w+,",
+                  ".bitmap_format = %s," % ("LV_FONT_FMT_TXT_COMPRESSED" if compress else "LV_FONT_FMT_TXT_PLAIN"), text)
+    if fallback:
+        text = text.replace(".fallback = NULL,", f".fallback = &{fallback},")
+
+    # Public symbol, config guard and include path
+    old_symbol = re.search(r"\blv_font_t\s+(\w+)\s*=\s*\{", text).group(1)
+    text = re.sub(r"\b%s\b" % re.escape(old_symbol), symbol, text)
+    text = re.sub(r"^#if LV_FONT_\w+[ \t]*$", "#if 1", text, count=1, flags=re.M)
+    include = '#include "lvgl.h"'
+    if fallback:
+        include += "\n\nLV_FONT_DECLARE(%s)" % fallback
+    text = re.sub(r"#ifdef LV_LVGL_H_INCLUDE_SIMPLE\n.*?#endif\n", lambda _: include + "\n", text, count=1, flags=re.S)
+
+    desc = "".join(chr(cp) for cp in codepoints)
+    header = (f"/* Generated by tools/subset_lv_font.py from {old_symbol}: {len(codepoints)} glyphs "
+              f"\"{desc}\", {out_bpp} bpp{', compressed' if compress else ''}. Do not edit. */\n\n")
+    stats = (old_symbol, len(glyphs) - 1, len(bitmap), len(codepoints), len(new_bitmap) + (1 if compress else 0))
+    return header + text, stats
+
+
+def main(argv):
+    parser = argparse.ArgumentParser(description="Subset an LVGL C font to the given characters.")
+    parser.add_argument("--bpp", type=int, choices=(3, 4), default=4)
+    parser.add_argument("--compress", action="store_true")
+    parser.add_argument("--fallback")
+    parser.add_argument("input")
+    parser.add_argument("symbol")
+    parser.add_argument("chars")
+    parser.add_argument("output")
+    args = parser.parse_args(argv[1:])
+    if args.bpp == 3 and not args.compress:
+        parser.error("--bpp 3 needs --compress (LVGL draws 3 bpp only from compressed bitmaps)")
+
+    with open(args.input, encoding="utf-8") as f:
+        text = f.read()
+    out, (name, glyphs_in, bytes_in, glyphs_out, bytes_out) = subset(
+        text, args.symbol, args.chars, args.bpp, args.compress, args.fallback)
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write(out)
+    print(f"{args.symbol}: {glyphs_out}/{glyphs_in} glyphs of {name}, "
+          f"bitmap {bytes_in} -> {bytes_out} bytes")
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main(sys.argv))